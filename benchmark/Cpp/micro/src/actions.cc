@@ -0,0 +1,121 @@
+// Benchmarks for advancing logical time and scheduling actions.
+
+#include <atomic>
+
+#include "common.hh"
+
+namespace {
+
+using namespace lf_micro;
+
+// Advances logical time by a periodic timer until the given number of events has been processed. No events are
+// scheduled by reactions, so this measures the baseline cost of processing a tag that all other benchmarks build on.
+class Ticker : public reactor::Reactor {
+public:
+  explicit Ticker(reactor::Environment* environment)
+      : reactor::Reactor("ticker", environment) {}
+
+  void assemble() override { r_tick.declare_trigger(&timer); }
+
+private:
+  std::int64_t remaining_{events};
+
+  reactor::Timer timer{"timer", this, reactor::Duration{1}, reactor::Duration::zero()};
+  reactor::Reaction r_tick{"r_tick", 1, this, [this]() {
+                             if (--remaining_ == 0) {
+                               environment()->sync_shutdown();
+                             }
+                           }};
+};
+
+struct TickerProgram {
+  reactor::Environment environment;
+  Ticker ticker{&environment};
+
+  explicit TickerProgram(unsigned workers)
+      : environment{workers, true} {}
+};
+
+void BM_TagAdvance(benchmark::State& state) { run<TickerProgram>(state); }
+
+// Schedules a logical action carrying a value for the next microstep until the given number of events has been
+// scheduled.
+template <class T> class Scheduler : public reactor::Reactor {
+public:
+  explicit Scheduler(reactor::Environment* environment)
+      : reactor::Reactor("scheduler", environment) {}
+
+  void assemble() override {
+    r_schedule.declare_trigger(&startup);
+    r_schedule.declare_trigger(&action);
+    r_schedule.declare_schedulable_action(&action);
+  }
+
+private:
+  const T value_{make_value<T>()};
+  std::int64_t remaining_{events};
+
+  reactor::StartupTrigger startup{"startup", this};
+  reactor::LogicalAction<T> action{"action", this};
+  reactor::Reaction r_schedule{"r_schedule", 1, this, [this]() {
+                                 if (remaining_-- > 0) {
+                                   action.schedule(value_);
+                                 } else {
+                                   environment()->sync_shutdown();
+                                 }
+                               }};
+};
+
+template <class T> struct SchedulerProgram {
+  reactor::Environment environment;
+  Scheduler<T> scheduler{&environment};
+
+  explicit SchedulerProgram(unsigned workers)
+      : environment{workers, true} {}
+};
+
+template <class T> void BM_LogicalActionSchedule(benchmark::State& state) { run<SchedulerProgram<T>>(state); }
+
+// Receives values of a physical action that is scheduled by the benchmark thread.
+class Receiver : public reactor::Reactor {
+public:
+  reactor::PhysicalAction<std::int64_t> action{"action", this};
+  std::atomic<std::int64_t> received{0};
+
+  explicit Receiver(reactor::Environment* environment)
+      : reactor::Reactor("receiver", environment) {}
+
+  void assemble() override { r_receive.declare_trigger(&action); }
+
+private:
+  reactor::Reaction r_receive{"r_receive", 1, this, [this]() {
+                                received.fetch_add(1, std::memory_order_relaxed);
+                              }};
+};
+
+void BM_PhysicalActionSchedule(benchmark::State& state) {
+  reactor::Environment environment{static_cast<unsigned>(state.range(0))};
+  Receiver receiver{&environment};
+  environment.assemble();
+  auto thread = environment.startup();
+
+  // scheduling from a foreign thread contends with the scheduler for the event queue
+  for (auto _ : state) {
+    receiver.action.schedule(1);
+  }
+
+  environment.async_shutdown();
+  thread.join();
+  state.SetItemsProcessed(state.iterations());
+  state.counters["received"] = static_cast<double>(receiver.received.load());
+}
+
+} // namespace
+
+BENCHMARK(BM_TagAdvance)->Apply(apply_workers);
+
+BENCHMARK_TEMPLATE(BM_LogicalActionSchedule, std::int64_t)->Apply(apply_workers);
+BENCHMARK_TEMPLATE(BM_LogicalActionSchedule, std::string)->Apply(apply_workers);
+BENCHMARK_TEMPLATE(BM_LogicalActionSchedule, std::vector<double>)->Apply(apply_workers);
+
+BENCHMARK(BM_PhysicalActionSchedule)->Apply(apply_workers);
@@ -0,0 +1,68 @@
+// Benchmarks for constructing and assembling programs.
+
+#include <memory>
+
+#include "common.hh"
+
+namespace {
+
+using namespace lf_micro;
+
+// Forwards its input to its output, like most reactors in a pipeline.
+class Relay : public reactor::Reactor {
+public:
+  reactor::Input<std::int64_t> in{"in", this};
+  reactor::Output<std::int64_t> out{"out", this};
+
+  Relay(const std::string& name, reactor::Reactor* container)
+      : reactor::Reactor(name, container) {}
+
+  void assemble() override {
+    r_forward.declare_trigger(&in);
+    r_forward.declare_antidependency(&out);
+  }
+
+private:
+  reactor::Reaction r_forward{"r_forward", 1, this, [this]() { out.set(in.get()); }};
+};
+
+// A chain of relays, connected in the same way as in generated code.
+class Chain : public reactor::Reactor {
+public:
+  Chain(reactor::Environment* environment, std::size_t length)
+      : reactor::Reactor("chain", environment) {
+    relays_.reserve(length);
+    for (std::size_t i = 0; i < length; i++) {
+      relays_.emplace_back(std::make_unique<Relay>("relay_" + std::to_string(i), this));
+    }
+  }
+
+  void assemble() override {
+    for (std::size_t i = 1; i < relays_.size(); i++) {
+      environment()->draw_connection(&relays_[i - 1]->out, &relays_[i]->in,
+                                     reactor::ConnectionProperties{reactor::ConnectionType::Normal,
+                                                                   reactor::Duration::zero(), nullptr});
+    }
+  }
+
+private:
+  std::vector<std::unique_ptr<Relay>> relays_;
+};
+
+// Measures the time for constructing, connecting and assembling a chain of the given length. Dividing by the number
+// of processed items gives the cost per reactor and connection.
+void BM_Assemble(benchmark::State& state) {
+  auto length = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    reactor::Environment environment{1, true};
+    Chain chain{&environment, length};
+    environment.assemble();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Assemble)->ArgName("reactors")->RangeMultiplier(4)->Range(16, 4096)->Complexity();
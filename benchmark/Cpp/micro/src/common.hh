@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <reactor-cpp/reactor-cpp.hh>
+
+namespace lf_micro {
+
+// Values that are sent through ports and actions. The benchmarks are instantiated for a scalar type, a short string and
+// a larger vector to expose the cost of copying values into the runtime.
+template <class T> auto make_value() -> T;
+template <> inline auto make_value<std::int64_t>() -> std::int64_t { return 42; }
+template <> inline auto make_value<std::string>() -> std::string { return std::string(64, 'x'); }
+template <> inline auto make_value<std::vector<double>>() -> std::vector<double> {
+  return std::vector<double>(1024, 1.0);
+}
+
+// Number of events that each execution of a program processes before it shuts down.
+constexpr std::int64_t events = 10000;
+
+/**
+ * Execute a fresh program once per benchmark iteration and report the processed events.
+ *
+ * The iterations are driven by the benchmark thread, while the program runs on the worker threads of the runtime.
+ * Only the execution from startup until the program shuts down after `events` events is measured, not its
+ * construction, assembly or destruction. A program owns its environment in a member called `environment`, which is
+ * constructed from the number of workers, and all its reactors.
+ */
+template <class Program, class... Args> void run(benchmark::State& state, const Args&... args) {
+  auto workers = static_cast<unsigned>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    {
+      auto program = std::make_unique<Program>(workers, args...);
+      program->environment.assemble();
+      state.ResumeTiming();
+      auto thread = program->environment.startup();
+      thread.join();
+      state.PauseTiming();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * events);
+}
+
+// Worker counts used for all benchmarks that execute a program.
+inline void apply_workers(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("workers");
+  for (auto workers : {1, 2, 4}) {
+    bench->Arg(workers);
+  }
+  // the scheduler runs on other threads, so CPU time of the benchmark thread is meaningless
+  bench->UseRealTime();
+}
+
+} // namespace lf_micro
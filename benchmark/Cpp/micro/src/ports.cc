@@ -0,0 +1,170 @@
+// Benchmarks for setting and reading ports and multiports.
+
+#include "common.hh"
+
+namespace {
+
+using namespace lf_micro;
+
+// Sets its output once per tag until it has sent the given number of events.
+template <class T> class Source : public reactor::Reactor {
+public:
+  reactor::Output<T> out{"out", this};
+
+  explicit Source(reactor::Environment* environment)
+      : reactor::Reactor("source", environment) {}
+
+  void assemble() override {
+    r_step.declare_trigger(&startup);
+    r_step.declare_trigger(&next);
+    r_step.declare_antidependency(&out);
+    r_step.declare_schedulable_action(&next);
+  }
+
+private:
+  const T value_{make_value<T>()};
+  std::int64_t remaining_{events};
+
+  reactor::StartupTrigger startup{"startup", this};
+  reactor::LogicalAction<void> next{"next", this};
+  reactor::Reaction r_step{"r_step", 1, this, [this]() {
+                             if (remaining_-- > 0) {
+                               out.set(value_);
+                               next.schedule();
+                             } else {
+                               environment()->sync_shutdown();
+                             }
+                           }};
+};
+
+template <class T> class Sink : public reactor::Reactor {
+public:
+  reactor::Input<T> in{"in", this};
+
+  explicit Sink(reactor::Environment* environment)
+      : reactor::Reactor("sink", environment) {}
+
+  void assemble() override { r_receive.declare_trigger(&in); }
+
+private:
+  reactor::Reaction r_receive{"r_receive", 1, this, [this]() { benchmark::DoNotOptimize(*in.get()); }};
+};
+
+template <class T> struct PortProgram {
+  reactor::Environment environment;
+  Source<T> source{&environment};
+  Sink<T> sink{&environment};
+
+  explicit PortProgram(unsigned workers)
+      : environment{workers, true} {
+    environment.draw_connection(&source.out, &sink.in,
+                                reactor::ConnectionProperties{reactor::ConnectionType::Normal,
+                                                              reactor::Duration::zero(), nullptr});
+  }
+};
+
+template <class T> void BM_PortSetGet(benchmark::State& state) { run<PortProgram<T>>(state); }
+
+// Sets all channels of a multiport once per tag until it has sent the given number of events.
+class MultiportSource : public reactor::Reactor {
+public:
+  reactor::ModifableMultiport<reactor::Output<std::int64_t>> out;
+
+  MultiportSource(reactor::Environment* environment, std::size_t width)
+      : reactor::Reactor("source", environment) {
+    out.reserve(width);
+    for (std::size_t i = 0; i < width; i++) {
+      out.emplace_back("out_" + std::to_string(i), this);
+    }
+  }
+
+  void assemble() override {
+    r_step.declare_trigger(&startup);
+    r_step.declare_trigger(&next);
+    for (auto& port : out) {
+      r_step.declare_antidependency(&port);
+    }
+    r_step.declare_schedulable_action(&next);
+  }
+
+private:
+  std::int64_t remaining_{events};
+
+  reactor::StartupTrigger startup{"startup", this};
+  reactor::LogicalAction<void> next{"next", this};
+  reactor::Reaction r_step{"r_step", 1, this, [this]() {
+                             if (remaining_-- > 0) {
+                               for (auto& port : out) {
+                                 port.set(1);
+                               }
+                               next.schedule();
+                             } else {
+                               environment()->sync_shutdown();
+                             }
+                           }};
+};
+
+// Reads the present channels of a multiport, which is the common pattern in generated code.
+class MultiportSink : public reactor::Reactor {
+public:
+  reactor::ModifableMultiport<reactor::Input<std::int64_t>> in;
+
+  MultiportSink(reactor::Environment* environment, std::size_t width)
+      : reactor::Reactor("sink", environment) {
+    in.reserve(width);
+    for (std::size_t i = 0; i < width; i++) {
+      in.emplace_back("in_" + std::to_string(i), this);
+    }
+  }
+
+  void assemble() override {
+    for (auto& port : in) {
+      r_receive.declare_trigger(&port);
+    }
+  }
+
+private:
+  std::int64_t sum_{0};
+
+  reactor::Reaction r_receive{"r_receive", 1, this, [this]() {
+                                for (auto i : in.present_indices_unsorted()) {
+                                  sum_ += *in[i].get();
+                                }
+                                benchmark::DoNotOptimize(sum_);
+                              }};
+};
+
+struct MultiportProgram {
+  reactor::Environment environment;
+  MultiportSource source;
+  MultiportSink sink;
+
+  MultiportProgram(unsigned workers, std::size_t width)
+      : environment{workers, true}
+      , source{&environment, width}
+      , sink{&environment, width} {
+    for (std::size_t i = 0; i < width; i++) {
+      environment.draw_connection(&source.out[i], &sink.in[i],
+                                  reactor::ConnectionProperties{reactor::ConnectionType::Normal,
+                                                                reactor::Duration::zero(), nullptr});
+    }
+  }
+};
+
+void BM_MultiportIteration(benchmark::State& state) {
+  auto width = static_cast<std::size_t>(state.range(1));
+  run<MultiportProgram>(state, width);
+  // every channel that was received counts as one item
+  state.SetItemsProcessed(state.iterations() * events * state.range(1));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_PortSetGet, std::int64_t)->Apply(apply_workers);
+BENCHMARK_TEMPLATE(BM_PortSetGet, std::string)->Apply(apply_workers);
+BENCHMARK_TEMPLATE(BM_PortSetGet, std::vector<double>)->Apply(apply_workers);
+
+BENCHMARK(BM_MultiportIteration)
+    ->ArgNames({"workers", "width"})
+    ->ArgsProduct({{1, 2, 4}, {1, 16, 256}})
+    ->UseRealTime();
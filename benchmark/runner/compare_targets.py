@@ -0,0 +1,342 @@
+#!/usr/bin/env python3
+"""Compare the performance of the same Lingua Franca program across targets.
+
+Some programs exist for several targets with the same structure and the same size parameters. This
+script compiles a program for every target that provides it, runs all variants with identical parameters
+and worker counts, and writes a single report that compares
+
+    * the end-to-end latency of a run (median and 90th percentile of the wall-clock time),
+    * the throughput in operations per second (for programs with a known number of operations),
+    * the peak memory usage (maximum resident set size), and
+    * the startup time of the target (the wall-clock time of a program that does nothing).
+
+The number of workers is set with the `--workers` option of lfc, so that it is applied in the same
+way for all targets. Problem sizes are set by overriding the default values of reactor parameters
+in a copy of the sources, since not all targets accept parameters on the command line. The
+overrides are given per target, since the parameters of a program may differ in name.
+
+Build variants of the same target can be compared by adding target properties to the programs with
+`--variant NAME=PROPERTIES`, which may be given multiple times.
+
+Examples:
+
+    ./benchmark/runner/compare_targets.py --programs PingPong --size small --workers 1,4
+    ./benchmark/runner/compare_targets.py --targets C --variant "unity=unity-build: true" --variant "lto=lto: true"
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import re
+import shutil
+import statistics
+import subprocess
+import sys
+from pathlib import Path
+
+from run_benchmarks import REPO_ROOT, git_revision
+
+TEST_ROOT = REPO_ROOT / "test"
+SAVINA_CPP = REPO_ROOT / "benchmark" / "Cpp" / "Savina" / "src"
+TARGETS = ["C", "Cpp", "Python", "Rust"]
+
+# Programs that can be compared. For each target that provides a program, "sources" gives the
+# directory that contains it, which is copied as a whole since programs may import reactors from
+# other files. For each problem size, "parameters" gives the parameter overrides per target and
+# reactor, and "operations" the number of operations, which is used to compute the throughput.
+# Programs are only run for the targets listed in "sources"; other selected targets are skipped
+# with a note.
+PROGRAMS = {
+    # The Savina version for C++ repeats the benchmark num_iterations times, so it is run once. Its
+    # main reactor has no name and is given by the empty string.
+    "PingPong": {
+        "sources": {"C": TEST_ROOT / "C" / "src", "Cpp": SAVINA_CPP, "Python": TEST_ROOT / "Python" / "src"},
+        "small": {
+            "parameters": {
+                "C": {"Ping": {"count": 10000}, "Pong": {"expected": 10000}},
+                "Cpp": {"": {"num_iterations": 1, "count": 10000}},
+                "Python": {"Ping": {"count": 10000}, "Pong": {"expected": 10000}},
+            },
+            "operations": 10000,
+        },
+        "default": {
+            "parameters": {
+                "C": {"Ping": {"count": 1000000}, "Pong": {"expected": 1000000}},
+                "Cpp": {"": {"num_iterations": 1, "count": 1000000}},
+                "Python": {"Ping": {"count": 1000000}, "Pong": {"expected": 1000000}},
+            },
+            "operations": 1000000,
+        },
+    },
+}
+
+# Reaction body that does nothing in each target.
+EMPTY_BODY = {"C": "", "Cpp": "", "Python": "pass", "Rust": ""}
+
+# Measures a single run of a program in a separate process, since the maximum resident set size
+# of children accumulates over the lifetime of a process.
+MEASURE = """
+import json, resource, subprocess, sys, time
+begin = time.monotonic()
+code = subprocess.run(sys.argv[1:], stdout=subprocess.DEVNULL).returncode
+wall = time.monotonic() - begin
+rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+if sys.platform == "darwin":
+    rss //= 1024
+print(json.dumps({"returncode": code, "wall_time_s": wall, "max_rss_kb": rss}))
+"""
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--programs", default=",".join(PROGRAMS),
+                        help="Comma-separated list of programs to compare (default: all).")
+    parser.add_argument("--targets", default=",".join(TARGETS),
+                        help="Comma-separated list of targets to compare (default: all).")
+    parser.add_argument("--size", default="default", choices=["small", "default"],
+                        help="The problem size to use.")
+    parser.add_argument("--workers", default="1,4", help="Comma-separated list of worker counts.")
+    parser.add_argument("--repetitions", type=int, default=5, help="Number of runs of each variant.")
+    parser.add_argument("--timeout", type=float, default=600.0, help="Timeout in seconds for a single run.")
+    parser.add_argument("--lfc", default=str(REPO_ROOT / "build" / "install" / "lf-cli" / "bin" / "lfc"),
+                        help="Path to the lfc executable.")
+    parser.add_argument("--build-dir", default=str(REPO_ROOT / "build" / "compare"),
+                        help="Directory for the sources and compiled programs.")
+    parser.add_argument("--output", default=str(REPO_ROOT / "build" / "compare" / "report.json"),
+                        help="Path of the JSON report.")
+    parser.add_argument("--markdown", help="Optional path of a Markdown file with the comparison tables.")
+    parser.add_argument("--variant", action="append", default=[], metavar="NAME=PROPERTIES",
+                        help="A build variant with additional target properties, e.g., \"lto=lto: true\". "
+                             "The programs are also measured without additional properties.")
+    return parser.parse_args()
+
+
+def parse_variants(specs):
+    """Return a dictionary from variant names to the target properties that are added."""
+    variants = {"default": ""}
+    for spec in specs:
+        name, sep, properties = spec.partition("=")
+        if not sep or not name.strip():
+            raise ValueError(f"invalid variant {spec}, expected NAME=PROPERTIES")
+        variants[name.strip()] = properties.strip()
+    return variants
+
+
+def add_target_properties(source, properties):
+    """Return the given LF source with the given target properties added to the target declaration."""
+    if not properties:
+        return source
+    declaration = re.search(r"\btarget\s+\w+(\s*\{)?", source)
+    if declaration is None:
+        raise RuntimeError("target declaration not found")
+    if declaration.group(1):
+        return source[:declaration.end()] + f"\n  {properties}," + source[declaration.end():]
+    return source[:declaration.end()] + f" {{\n  {properties}\n}}" + source[declaration.end():]
+
+
+def override_parameters(source, overrides):
+    """Return the given LF source with the default values of the given reactor parameters replaced."""
+    for reactor, parameters in overrides.items():
+        header = re.search(rf"\breactor\s*{reactor}\s*(<[^>]*>)?\s*\(([^)]*)\)", source)
+        if header is None:
+            raise RuntimeError(f"reactor {reactor} with parameters not found")
+        params = header.group(2)
+        for name, value in parameters.items():
+            # matches both `name: type = value` and `name = value`
+            params, count = re.subn(rf"(\b{name}\s*(?::\s*[^=,]+)?=\s*)[^,]+", rf"\g<1>{value}", params)
+            if count != 1:
+                raise RuntimeError(f"parameter {name} of reactor {reactor} not found")
+        source = source[:header.start(2)] + params + source[header.end(2):]
+    return source
+
+
+def prepare_sources(target, program, config, build_dir, properties=""):
+    """Copy the sources of the given program and target and apply the parameter overrides to the program."""
+    source_dir = build_dir / "src"
+    if source_dir.exists():
+        shutil.rmtree(source_dir)
+    # copy the complete directory, since programs may import reactors from other files
+    shutil.copytree(PROGRAMS[program]["sources"][target], source_dir)
+    source = source_dir / f"{program}.lf"
+    overrides = config.get("parameters", {}).get(target, {})
+    source.write_text(add_target_properties(override_parameters(source.read_text(), overrides), properties))
+    return source
+
+
+def write_startup_program(target, build_dir):
+    """Write a program that terminates immediately, which is used for measuring the startup time."""
+    source = build_dir / target / "startup" / "Startup.lf"
+    source.parent.mkdir(parents=True, exist_ok=True)
+    source.write_text(f"target {target} {{\n  fast: true\n}}\n\n"
+                      f"main reactor Startup {{\n  reaction(startup) {{= {EMPTY_BODY[target]} =}}\n}}\n")
+    return source
+
+
+# Word boundaries of camel case names, as in StringUtil.camelToSnakeCase of lfc.
+CAMEL_WORD_BOUNDARY = re.compile(r"(?<![A-Z])(?=[A-Z])|(?<=[A-Z])(?=[A-Z][a-z])")
+
+
+def executable_name(target, name):
+    """Return the name of the executable that lfc produces for the given main reactor in a target."""
+    if target == "Rust":
+        return "_".join(word.lower() for word in CAMEL_WORD_BOUNDARY.split(name) if word)
+    return name
+
+
+def compile_program(lfc, target, source, output_dir, workers):
+    """Compile a program with lfc and return the path of the resulting executable."""
+    print(f"Compiling {source.name} into {output_dir} with {workers} workers", flush=True)
+    subprocess.run([lfc, "--workers", str(workers), "--output-path", str(output_dir), str(source)], check=True)
+    executable = output_dir / "bin" / executable_name(target, source.stem)
+    if not executable.exists():
+        raise RuntimeError(f"lfc did not produce {executable}")
+    return executable
+
+
+def measure(executable, repetitions, timeout):
+    """Run the given executable repeatedly and return the wall-clock times and the peak memory usage."""
+    times = []
+    max_rss = 0
+    for _ in range(repetitions):
+        try:
+            process = subprocess.run([sys.executable, "-c", MEASURE, str(executable)], capture_output=True,
+                                     text=True, timeout=timeout, check=True)
+        except subprocess.TimeoutExpired:
+            raise RuntimeError(f"{executable.name} did not finish within {timeout} seconds")
+        run = json.loads(process.stdout.splitlines()[-1])
+        if run["returncode"] != 0:
+            raise RuntimeError(f"{executable.name} failed with exit code {run['returncode']}")
+        times.append(run["wall_time_s"])
+        max_rss = max(max_rss, run["max_rss_kb"])
+    return times, max_rss
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(round(p / 100 * (len(values) - 1))))]
+
+
+def format_table(results, startup):
+    """Return a Markdown table per program that compares the targets."""
+    lines = []
+    for program in dict.fromkeys(r["program"] for r in results):
+        lines += [f"### {program}", "",
+                  "| target | variant | workers | median (ms) | p90 (ms) | throughput (ops/s) | max RSS (MiB) "
+                  "| startup (ms) |",
+                  "|---|---|---:|---:|---:|---:|---:|---:|"]
+        for r in (r for r in results if r["program"] == program):
+            throughput = f"{r['throughput_ops']:.0f}" if r["throughput_ops"] is not None else "-"
+            start = startup.get(r["target"], {}).get(r["workers"])
+            lines.append(f"| {r['target']} | {r['variant']} | {r['workers']} | {r['median_ms']:.1f} "
+                         f"| {r['p90_ms']:.1f} "
+                         f"| {throughput} | {r['max_rss_kb'] / 1024:.1f} "
+                         f"| {f'{start:.1f}' if start is not None else '-'} |")
+        lines.append("")
+    return "\n".join(lines)
+
+
+def main():
+    args = parse_args()
+    programs = [p.strip() for p in args.programs.split(",") if p.strip()]
+    unknown = [p for p in programs if p not in PROGRAMS]
+    if unknown:
+        sys.exit(f"Unknown programs: {', '.join(unknown)}")
+    targets = [t.strip() for t in args.targets.split(",") if t.strip()]
+    unknown = [t for t in targets if t not in TARGETS]
+    if unknown:
+        sys.exit(f"Unknown targets: {', '.join(unknown)}")
+    workers = [int(w) for w in args.workers.split(",")]
+    try:
+        variants = parse_variants(args.variant)
+    except ValueError as e:
+        sys.exit(str(e))
+    build_dir = Path(args.build_dir)
+
+    results = []
+    skipped = []
+    failures = []
+    startup = {}
+    for target in targets:
+        for num_workers in workers:
+            try:
+                output_dir = build_dir / target / f"startup-{num_workers}"
+                executable = compile_program(args.lfc, target, write_startup_program(target, build_dir),
+                                             output_dir, num_workers)
+                times, _ = measure(executable, args.repetitions, args.timeout)
+                startup.setdefault(target, {})[num_workers] = statistics.median(times) * 1000
+            except (RuntimeError, subprocess.CalledProcessError) as e:
+                print(f"error: startup program for {target}: {e}", file=sys.stderr)
+
+    for program in programs:
+        config = PROGRAMS[program][args.size]
+        available = [t for t in targets if t in PROGRAMS[program]["sources"]]
+        missing = [t for t in targets if t not in available]
+        if missing:
+            print(f"note: skipping {program} for {', '.join(missing)}, where it does not exist", file=sys.stderr)
+            skipped += [f"{program} ({t})" for t in missing]
+        for target, (variant, properties) in ((t, v) for t in available for v in variants.items()):
+            try:
+                variant_dir = build_dir / target / variant
+                source = prepare_sources(target, program, config, variant_dir, properties)
+                for num_workers in workers:
+                    output_dir = variant_dir / f"{program}-{num_workers}"
+                    executable = compile_program(args.lfc, target, source, output_dir, num_workers)
+                    times, max_rss = measure(executable, args.repetitions, args.timeout)
+                    median = statistics.median(times)
+                    # the throughput excludes the startup time of the target
+                    start = startup.get(target, {}).get(num_workers, 0) / 1000
+                    operations = config.get("operations")
+                    throughput = operations / (median - start) if operations and median > start else None
+                    results.append({
+                        "program": program,
+                        "target": target,
+                        "variant": variant,
+                        "properties": properties,
+                        "workers": num_workers,
+                        "parameters": config.get("parameters", {}).get(target, {}),
+                        "times_ms": [t * 1000 for t in times],
+                        "median_ms": median * 1000,
+                        "p90_ms": percentile(times, 90) * 1000,
+                        "throughput_ops": throughput,
+                        "max_rss_kb": max_rss,
+                    })
+            except (RuntimeError, subprocess.CalledProcessError) as e:
+                print(f"error: {program} ({target}, {variant}): {e}", file=sys.stderr)
+                failures.append(f"{program} ({target}, {variant})")
+
+    report = {
+        "metadata": {
+            "date": datetime.datetime.now(datetime.timezone.utc).isoformat(),
+            "revision": git_revision(),
+            "host": platform.node(),
+            "platform": platform.platform(),
+            "cpu_count": os.cpu_count(),
+            "size": args.size,
+            "repetitions": args.repetitions,
+        },
+        "startup_ms": startup,
+        "results": results,
+        "skipped": skipped,
+        "failures": failures,
+    }
+    output = Path(args.output)
+    output.parent.mkdir(parents=True, exist_ok=True)
+    output.write_text(json.dumps(report, indent=2) + "\n")
+    print(f"Wrote report to {output}")
+
+    table = format_table(results, startup)
+    if skipped:
+        table += f"\nNot measured, since the program does not exist for the target: {', '.join(skipped)}\n"
+    print(table)
+    if args.markdown:
+        Path(args.markdown).write_text(table)
+        print(f"Wrote comparison tables to {args.markdown}")
+
+    if failures:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
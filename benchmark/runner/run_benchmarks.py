@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""Build and run the Lingua Franca benchmark suite and collect machine-readable results.
+
+Each benchmark program is compiled with lfc and executed with the requested number of workers and
+problem size. Benchmark programs report their measurements on a single line of the form
+
+    lf-benchmark-result: {"benchmark": ..., "median_ms": ..., ...}
+
+which is parsed by this script. The results of all runs are written to a JSON file (and optionally
+a CSV file), so that they can be compared across commits.
+
+Example:
+
+    ./benchmark/runner/run_benchmarks.py --benchmarks PingPong,Counting --size small --workers 1,4
+"""
+
+import argparse
+import csv
+import datetime
+import json
+import os
+import platform
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+BENCHMARK_ROOT = REPO_ROOT / "benchmark"
+RESULT_PREFIX = "lf-benchmark-result:"
+
+# Source directories of the benchmark programs for each target.
+TARGETS = {
+    "Cpp": BENCHMARK_ROOT / "Cpp" / "Savina" / "src",
+}
+
+# Benchmark parameters for each problem size. The parameters are passed to the main reactor on the
+# command line. The "small" size is meant for quick checks, e.g. in CI.
+BENCHMARKS = {
+    "PingPong": {
+        "small": {"count": 10000},
+        "default": {"count": 1000000},
+    },
+    "Counting": {
+        "small": {"count": 10000},
+        "default": {"count": 1000000},
+    },
+    "ThreadRing": {
+        "small": {"num_workers": 10, "num_hops": 1000},
+        "default": {"num_workers": 100, "num_hops": 100000},
+    },
+    "Chameneos": {
+        "small": {"num_chameneos": 10, "num_meetings": 1000},
+        "default": {"num_chameneos": 100, "num_meetings": 200000},
+    },
+    "Big": {
+        "small": {"num_workers": 10, "num_pings": 100},
+        "default": {"num_workers": 120, "num_pings": 20000},
+    },
+    "Philosophers": {
+        "small": {"num_philosophers": 5, "num_eating_rounds": 100},
+        "default": {"num_philosophers": 20, "num_eating_rounds": 10000},
+    },
+    "Banking": {
+        "small": {"num_accounts": 10, "num_transactions": 1000},
+        "default": {"num_accounts": 1000, "num_transactions": 50000},
+    },
+    "Trapezoid": {
+        "small": {"num_workers": 4, "num_pieces": 10000},
+        "default": {"num_workers": 100, "num_pieces": 10000000},
+    },
+    "MatMul": {
+        "small": {"num_workers": 4, "data_length": 64},
+        "default": {"num_workers": 20, "data_length": 1024},
+    },
+}
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--target", default="Cpp", choices=sorted(TARGETS), help="The target to benchmark.")
+    parser.add_argument("--benchmarks", default=",".join(BENCHMARKS),
+                        help="Comma-separated list of benchmarks to run (default: all).")
+    parser.add_argument("--size", default="default", choices=["small", "default"],
+                        help="The problem size to use.")
+    parser.add_argument("--workers", default="1,4", help="Comma-separated list of worker counts.")
+    parser.add_argument("--iterations", type=int, default=12, help="Number of iterations per run.")
+    parser.add_argument("--timeout", type=float, default=600.0, help="Timeout in seconds for a single run.")
+    parser.add_argument("--lfc", default=str(REPO_ROOT / "build" / "install" / "lf-cli" / "bin" / "lfc"),
+                        help="Path to the lfc executable.")
+    parser.add_argument("--build-dir", default=str(REPO_ROOT / "build" / "benchmark"),
+                        help="Directory for the compiled benchmarks.")
+    parser.add_argument("--output", default=str(REPO_ROOT / "build" / "benchmark" / "results.json"),
+                        help="Path of the JSON results file.")
+    parser.add_argument("--csv", help="Optional path of a CSV file with one line per run.")
+    return parser.parse_args()
+
+
+def git_revision():
+    try:
+        return subprocess.run(["git", "rev-parse", "HEAD"], cwd=REPO_ROOT, capture_output=True, text=True,
+                              check=True).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def compile_benchmark(lfc, source, build_dir):
+    """Compile a benchmark with lfc and return the path of the resulting executable."""
+    print(f"Compiling {source.name}", flush=True)
+    subprocess.run([lfc, "--output-path", str(build_dir), str(source)], check=True)
+    executable = build_dir / "bin" / source.stem
+    if not executable.exists():
+        raise RuntimeError(f"lfc did not produce {executable}")
+    return executable
+
+
+def run_benchmark(executable, workers, iterations, params, timeout):
+    """Run a compiled benchmark and return the parsed result, extended by process level metrics."""
+    command = [str(executable), "--workers", str(workers), "--num_iterations", str(iterations)]
+    for name, value in params.items():
+        command += [f"--{name}", str(value)]
+    print(" ".join(command), flush=True)
+
+    begin = time.monotonic()
+    process = subprocess.Popen(command, stdout=subprocess.PIPE, text=True)
+    try:
+        stdout, _ = process.communicate(timeout=timeout)
+    except subprocess.TimeoutExpired:
+        process.kill()
+        process.communicate()
+        raise RuntimeError(f"{executable.name} did not finish within {timeout} seconds")
+    wall_time = time.monotonic() - begin
+    if process.returncode != 0:
+        raise RuntimeError(f"{executable.name} failed with exit code {process.returncode}")
+
+    result = None
+    for line in stdout.splitlines():
+        if line.startswith(RESULT_PREFIX):
+            result = json.loads(line[len(RESULT_PREFIX):])
+    if result is None:
+        raise RuntimeError(f"{executable.name} did not report a result")
+
+    result["workers"] = workers
+    result["parameters"] = params
+    result["wall_time_s"] = wall_time
+    return result
+
+
+def write_csv(path, results):
+    fields = ["benchmark", "target", "workers", "iterations", "operations", "median_ms", "min_ms", "max_ms",
+              "throughput_ops", "wall_time_s"]
+    with open(path, "w", newline="") as file:
+        writer = csv.DictWriter(file, fieldnames=fields, extrasaction="ignore")
+        writer.writeheader()
+        writer.writerows(results)
+
+
+def main():
+    args = parse_args()
+    source_dir = TARGETS[args.target]
+    benchmarks = [name.strip() for name in args.benchmarks.split(",") if name.strip()]
+    unknown = [name for name in benchmarks if name not in BENCHMARKS]
+    if unknown:
+        sys.exit(f"Unknown benchmarks: {', '.join(unknown)}")
+    workers = [int(w) for w in args.workers.split(",")]
+    build_dir = Path(args.build_dir) / args.target
+
+    results = []
+    failures = []
+    for name in benchmarks:
+        try:
+            executable = compile_benchmark(args.lfc, source_dir / f"{name}.lf", build_dir)
+            for num_workers in workers:
+                params = BENCHMARKS[name][args.size]
+                results.append(run_benchmark(executable, num_workers, args.iterations, params, args.timeout))
+        except (RuntimeError, subprocess.CalledProcessError) as e:
+            print(f"error: {name}: {e}", file=sys.stderr)
+            failures.append(name)
+
+    report = {
+        "metadata": {
+            "date": datetime.datetime.now(datetime.timezone.utc).isoformat(),
+            "revision": git_revision(),
+            "host": platform.node(),
+            "platform": platform.platform(),
+            "cpu_count": os.cpu_count(),
+            "size": args.size,
+        },
+        "results": results,
+        "failures": failures,
+    }
+    output = Path(args.output)
+    output.parent.mkdir(parents=True, exist_ok=True)
+    output.write_text(json.dumps(report, indent=2) + "\n")
+    print(f"Wrote results to {output}")
+    if args.csv:
+        write_csv(args.csv, results)
+        print(f"Wrote results to {args.csv}")
+
+    if failures:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -275,6 +275,22 @@ public class AttributeUtils {
     return getAttributeValues(node, "layout");
   }
 
+  /**
+   * Return whether the given node is selected for tracing by a {@code @trace} attribute. The
+   * attribute may be given as {@code @trace}, which is the same as {@code @trace(true)}, or as
+   * {@code @trace(false)}.
+   *
+   * <p>Returns null if there is no such attribute.
+   */
+  public static Boolean getTraceAttribute(EObject node) {
+    final var attr = findAttributeByName(node, "trace");
+    if (attr == null) {
+      return null;
+    }
+    final var value = getFirstArgumentValue(attr);
+    return value == null || value.equalsIgnoreCase("true");
+  }
+
   /**
    * Return the {@code @enclave} attribute annotated on the given node.
    *
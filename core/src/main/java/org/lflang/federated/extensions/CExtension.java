@@ -42,7 +42,9 @@ import org.lflang.federated.generator.FedConnectionInstance;
 import org.lflang.federated.generator.FederateInstance;
 import org.lflang.federated.generator.FederationFileConfig;
 import org.lflang.federated.launcher.RtiConfig;
+import org.lflang.federated.serialization.FedBinarySerialization;
 import org.lflang.federated.serialization.FedROS2CPPSerialization;
+import org.lflang.federated.serialization.FedSerialization;
 import org.lflang.generator.CodeBuilder;
 import org.lflang.generator.LFGeneratorContext;
 import org.lflang.generator.ReactorInstance;
@@ -215,6 +217,37 @@ public class CExtension implements FedTargetExtension {
           result.pr("lf_set(" + receiveRef + ", std::move(" + value + "));");
         }
       }
+      case BINARY -> {
+        var portTypeStr =
+            types.getTargetType(ASTUtils.getInferredType((Port) receivingPort.getVariable()));
+        if (!FedBinarySerialization.isSupported(portTypeStr)) {
+          messageReporter
+              .at(connection.getDefinition())
+              .error("The binary serializer does not support type " + portTypeStr + ".");
+        } else if (FedBinarySerialization.isString(portTypeStr)) {
+          // The received buffer holds the null-terminated string, so hand it over as is.
+          result.pr("lf_set_token(" + receiveRef + ", " + action.getName() + "->token);");
+        } else if (FedBinarySerialization.isArray(portTypeStr)) {
+          var binaryDeserializer = new FedBinarySerialization();
+          result.pr(
+              binaryDeserializer.generateNetworkArrayDeserializerCode(
+                  action.getName() + "->value", action.getName() + "->length", portTypeStr));
+          result.pr(
+              "lf_set_array("
+                  + receiveRef
+                  + ", "
+                  + FedSerialization.deserializedVarName
+                  + ", "
+                  + FedSerialization.deserializedVarName
+                  + "_length);");
+        } else {
+          var binaryDeserializer = new FedBinarySerialization();
+          result.pr(
+              binaryDeserializer.generateNetworkDeserializerCode(
+                  action.getName() + "->value", portTypeStr));
+          result.pr("lf_set(" + receiveRef + ", " + FedSerialization.deserializedVarName + ");");
+        }
+      }
     }
   }
 
@@ -430,6 +463,30 @@ public class CExtension implements FedTargetExtension {
         result.pr("size_t _lf_message_length = " + lengthExpression + ";");
         result.pr(sendingFunction + "(" + commonArgs + ", " + pointerExpression + ");");
       }
+      case BINARY -> {
+        var typeStr = types.getTargetType(type);
+        if (!FedBinarySerialization.isSupported(typeStr)) {
+          messageReporter
+              .at(connection.getDefinition())
+              .error("The binary serializer does not support type " + typeStr + ".");
+          return;
+        }
+        var binarySerializer = new FedBinarySerialization();
+        result.pr(binarySerializer.generateNetworkSerializerCode(sendRef, typeStr));
+        result.pr(
+            "size_t _lf_message_length = " + binarySerializer.serializedBufferLength() + ";");
+        result.pr(
+            sendingFunction
+                + "("
+                + commonArgs
+                + ", "
+                + binarySerializer.serializedBufferVar()
+                + ");");
+        if (FedBinarySerialization.isArray(typeStr)) {
+          // The message has been copied by the sending function.
+          result.pr("free(" + binarySerializer.serializedBufferVar() + ");");
+        }
+      }
     }
   }
 
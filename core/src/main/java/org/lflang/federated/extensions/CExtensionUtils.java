@@ -13,6 +13,7 @@ import org.lflang.ast.ASTUtils;
 import org.lflang.federated.generator.FederateInstance;
 import org.lflang.federated.generator.FederationFileConfig;
 import org.lflang.federated.launcher.RtiConfig;
+import org.lflang.federated.serialization.FedBinarySerialization;
 import org.lflang.federated.serialization.FedROS2CPPSerialization;
 import org.lflang.federated.serialization.SupportedSerializers;
 import org.lflang.generator.CodeBuilder;
@@ -496,6 +497,10 @@ public class CExtensionUtils {
           var ROSSerializer = new FedROS2CPPSerialization();
           code.pr(ROSSerializer.generatePreambleForSupport().toString());
         }
+        case BINARY -> {
+          var binarySerializer = new FedBinarySerialization();
+          code.pr(binarySerializer.generatePreambleForSupport().toString());
+        }
       }
     }
     return code.getCode();
@@ -506,7 +511,7 @@ public class CExtensionUtils {
     CodeBuilder code = new CodeBuilder();
     for (SupportedSerializers serializer : federate.enabledSerializers) {
       switch (serializer) {
-        case NATIVE, PROTO -> {
+        case NATIVE, PROTO, BINARY -> {
           // No CMake code is needed for now
         }
         case ROS2 -> {
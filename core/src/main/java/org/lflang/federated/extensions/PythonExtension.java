@@ -73,6 +73,10 @@ public class PythonExtension extends CExtension {
           {
             // FIXME: Not supported yet
           }
+        case BINARY:
+          {
+            // Not supported for the Python target
+          }
       }
     }
     return code.getCode();
@@ -148,6 +152,8 @@ public class PythonExtension extends CExtension {
           "Protobuf serialization is not supported yet.");
       case ROS2 -> throw new UnsupportedOperationException(
           "ROS2 serialization is not supported yet.");
+      case BINARY -> throw new UnsupportedOperationException(
+          "Binary serialization is not supported for the Python target.");
     }
   }
 
@@ -178,6 +184,8 @@ public class PythonExtension extends CExtension {
           "Protobuf serialization is not supported yet.");
       case ROS2 -> throw new UnsupportedOperationException(
           "ROS2 serialization is not supported yet.");
+      case BINARY -> throw new UnsupportedOperationException(
+          "Binary serialization is not supported for the Python target.");
     }
   }
 
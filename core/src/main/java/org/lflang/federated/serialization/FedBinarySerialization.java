@@ -0,0 +1,349 @@
+package org.lflang.federated.serialization;
+
+import java.util.Map;
+import org.lflang.generator.GeneratorBase;
+import org.lflang.target.Target;
+
+/**
+ * Enables support for the built-in binary serialization in C code.
+ *
+ * <p>The encoding is derived from the port type. Arithmetic types are encoded with a fixed number
+ * of bytes in little-endian byte order, so that federates on hosts with different byte orders or
+ * type widths can communicate. Arrays of arithmetic types are sent as the sequence of their
+ * encoded elements, whose number follows from the length of the message. Strings are sent as
+ * null-terminated byte sequences. The receiver decodes values directly from the received buffer
+ * and hands received strings to the port without copying them.
+ *
+ * <p>Only arithmetic types, arrays of arithmetic types (the token types {@code T[]}, {@code T[N]},
+ * and {@code T*}), and strings are supported. Other types, such as structs, are rejected.
+ */
+public class FedBinarySerialization implements FedSerialization {
+
+  /** The encoding of a type: the number of bytes and the function that decodes a value. */
+  private record Encoding(int size, String reader) {}
+
+  private static final Encoding INT8 = new Encoding(1, "lf_binary_read_int");
+  private static final Encoding UINT8 = new Encoding(1, "lf_binary_read_uint");
+  private static final Encoding INT16 = new Encoding(2, "lf_binary_read_int");
+  private static final Encoding UINT16 = new Encoding(2, "lf_binary_read_uint");
+  private static final Encoding INT32 = new Encoding(4, "lf_binary_read_int");
+  private static final Encoding UINT32 = new Encoding(4, "lf_binary_read_uint");
+  private static final Encoding INT64 = new Encoding(8, "lf_binary_read_int");
+  private static final Encoding UINT64 = new Encoding(8, "lf_binary_read_uint");
+  private static final Encoding FLOAT = new Encoding(4, "lf_binary_read_float");
+  private static final Encoding DOUBLE = new Encoding(8, "lf_binary_read_double");
+
+  /** The encodings of the supported arithmetic types. */
+  private static final Map<String, Encoding> encodings =
+      Map.ofEntries(
+          Map.entry("bool", UINT8),
+          Map.entry("char", INT8),
+          Map.entry("signed char", INT8),
+          Map.entry("unsigned char", UINT8),
+          Map.entry("int8_t", INT8),
+          Map.entry("uint8_t", UINT8),
+          Map.entry("short", INT16),
+          Map.entry("unsigned short", UINT16),
+          Map.entry("int16_t", INT16),
+          Map.entry("uint16_t", UINT16),
+          Map.entry("int", INT32),
+          Map.entry("unsigned", UINT32),
+          Map.entry("unsigned int", UINT32),
+          Map.entry("int32_t", INT32),
+          Map.entry("uint32_t", UINT32),
+          Map.entry("long", INT64),
+          Map.entry("unsigned long", UINT64),
+          Map.entry("long long", INT64),
+          Map.entry("unsigned long long", UINT64),
+          Map.entry("int64_t", INT64),
+          Map.entry("uint64_t", UINT64),
+          Map.entry("size_t", UINT64),
+          Map.entry("instant_t", INT64),
+          Map.entry("interval_t", INT64),
+          Map.entry("float", FLOAT),
+          Map.entry("double", DOUBLE));
+
+  /** Return true if values of the given target type can be sent with this serializer. */
+  public static boolean isSupported(String targetType) {
+    return isString(targetType) || encoding(targetType) != null || isArray(targetType);
+  }
+
+  /** Return true if the given target type is sent as a null-terminated string. */
+  public static boolean isString(String targetType) {
+    return targetType.equals("string") || targetType.equals("char*");
+  }
+
+  /** Return true if the given target type is sent as an array of arithmetic values. */
+  public static boolean isArray(String targetType) {
+    var element = elementType(targetType);
+    return element != null && encoding(element) != null;
+  }
+
+  /** Return the encoding of the given arithmetic type, or null if it is not supported. */
+  private static Encoding encoding(String type) {
+    return encodings.get(type);
+  }
+
+  /** Return the element type of the given array type, or null if it is not an array type. */
+  private static String elementType(String targetType) {
+    if (isString(targetType)) {
+      return null;
+    }
+    if (targetType.endsWith("*")) {
+      return targetType.substring(0, targetType.length() - 1).strip();
+    }
+    return null;
+  }
+
+  /** Return code that writes the given value of the given type to the given buffer. */
+  private static String write(String type, String buffer, String value) {
+    var encoding = encoding(type);
+    if (encoding == FLOAT) {
+      return "lf_binary_write_float(" + buffer + ", " + value + ");";
+    } else if (encoding == DOUBLE) {
+      return "lf_binary_write_double(" + buffer + ", " + value + ");";
+    }
+    return "lf_binary_write_uint("
+        + buffer
+        + ", (uint64_t) "
+        + value
+        + ", "
+        + encoding.size()
+        + ");";
+  }
+
+  /** Return an expression that reads a value of the given type from the given buffer. */
+  private static String read(String type, String buffer) {
+    var encoding = encoding(type);
+    if (encoding == FLOAT || encoding == DOUBLE) {
+      return "(" + type + ") " + encoding.reader() + "(" + buffer + ")";
+    }
+    return "(" + type + ") " + encoding.reader() + "(" + buffer + ", " + encoding.size() + ")";
+  }
+
+  /** Return the expression of the position of the element with the given index in a buffer. */
+  private static String offset(String buffer, String element, String index) {
+    return buffer + " + " + encoding(element).size() + " * " + index;
+  }
+
+  /**
+   * Check whether the current generator is compatible with the given serialization technique or
+   * not.
+   *
+   * @param generator The current generator.
+   * @return true if compatible, false if not.
+   */
+  @Override
+  public boolean isCompatible(GeneratorBase generator) {
+    if (generator.getTarget() != Target.C && generator.getTarget() != Target.CCPP) {
+      generator
+          .messageReporter
+          .nowhere()
+          .error("Binary serialization is currently only supported for the C target.");
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @return Expression in target language that corresponds to the length of the serialized buffer.
+   */
+  @Override
+  public String serializedBufferLength() {
+    return serializedVarName + "_length";
+  }
+
+  /**
+   * @return Expression in target language that is the buffer variable itself.
+   */
+  @Override
+  public String serializedBufferVar() {
+    return serializedVarName;
+  }
+
+  /**
+   * Generate code in C that serializes 'varName'. The serialized data will be put in a variable
+   * called 'serialized_message', defined by @see serializedVarName, and its length in a variable
+   * called 'serialized_message_length'. Strings are not copied. The buffer of an array is allocated
+   * on the heap and has to be freed after it is sent.
+   *
+   * @param varName The variable to be serialized.
+   * @param originalType The original type of the variable.
+   * @return Target code that serializes the 'varName' from 'type' to an unsigned byte array.
+   */
+  @Override
+  public StringBuilder generateNetworkSerializerCode(String varName, String originalType) {
+    StringBuilder serializerCode = new StringBuilder();
+    if (isString(originalType)) {
+      serializerCode
+          .append("unsigned char* " + serializedVarName + " = (unsigned char*) ")
+          .append(varName)
+          .append("->value;\n");
+      serializerCode
+          .append("size_t " + serializedBufferLength() + " = strlen(")
+          .append(varName)
+          .append("->value) + 1;\n");
+      return serializerCode;
+    }
+    if (isArray(originalType)) {
+      var element = elementType(originalType);
+      var length = varName + "->token->length";
+      serializerCode.append(
+          "size_t "
+              + serializedBufferLength()
+              + " = "
+              + length
+              + " * "
+              + encoding(element).size()
+              + ";\n");
+      serializerCode.append(
+          "unsigned char* "
+              + serializedVarName
+              + " = (unsigned char*) malloc("
+              + serializedBufferLength()
+              + ");\n");
+      serializerCode.append("for (size_t i = 0; i < " + length + "; i++) {\n");
+      serializerCode.append(
+          "    "
+              + write(element, offset(serializedVarName, element, "i"), varName + "->value[i]")
+              + "\n");
+      serializerCode.append("}\n");
+      return serializerCode;
+    }
+    var encoding = encoding(originalType);
+    serializerCode.append("unsigned char " + serializedVarName + "[" + encoding.size() + "];\n");
+    serializerCode.append("size_t " + serializedBufferLength() + " = " + encoding.size() + ";\n");
+    serializerCode.append(write(originalType, serializedVarName, varName + "->value") + "\n");
+    return serializerCode;
+  }
+
+  /**
+   * Generate code in C that deserializes the arithmetic value in 'varName', which points to the
+   * received buffer. The value is read from the buffer in place and put in a variable called
+   * deserialized_message defined by @see deserializedVarName. Strings do not need to be
+   * deserialized, and arrays are deserialized with {@link
+   * #generateNetworkArrayDeserializerCode(String, String, String)}.
+   *
+   * @param varName The variable to deserialize.
+   * @param targetType The type to deserialize into.
+   * @return Target code that deserializes 'varName' from an unsigned byte array to 'type'.
+   */
+  @Override
+  public StringBuilder generateNetworkDeserializerCode(String varName, String targetType) {
+    StringBuilder deserializerCode = new StringBuilder();
+    deserializerCode.append(
+        targetType + " " + deserializedVarName + " = " + read(targetType, varName) + ";\n");
+    return deserializerCode;
+  }
+
+  /**
+   * Generate code in C that deserializes the array in 'varName', which points to a received buffer
+   * of 'length' bytes. The elements are decoded into an array that is allocated on the heap and
+   * put in a variable called deserialized_message, defined by @see deserializedVarName. The number
+   * of elements is put in a variable called deserialized_message_length. The array can be handed
+   * to the port with {@code lf_set_array}, which frees it once it is no longer used.
+   *
+   * @param varName The variable to deserialize.
+   * @param length The number of bytes in the received buffer.
+   * @param targetType The array type to deserialize into.
+   * @return Target code that deserializes 'varName' from an unsigned byte array to 'type'.
+   */
+  public StringBuilder generateNetworkArrayDeserializerCode(
+      String varName, String length, String targetType) {
+    var element = elementType(targetType);
+    var count = deserializedVarName + "_length";
+    StringBuilder deserializerCode = new StringBuilder();
+    deserializerCode.append(
+        "size_t " + count + " = " + length + " / " + encoding(element).size() + ";\n");
+    deserializerCode.append(
+        element
+            + "* "
+            + deserializedVarName
+            + " = ("
+            + element
+            + "*) malloc("
+            + count
+            + " * sizeof("
+            + element
+            + "));\n");
+    deserializerCode.append("for (size_t i = 0; i < " + count + "; i++) {\n");
+    deserializerCode.append(
+        "    "
+            + deserializedVarName
+            + "[i] = "
+            + read(element, offset(varName, element, "i"))
+            + ";\n");
+    deserializerCode.append("}\n");
+    return deserializerCode;
+  }
+
+  /**
+   * @return Code in C that defines the functions used by the generated serialization code.
+   */
+  @Override
+  public StringBuilder generatePreambleForSupport() {
+    StringBuilder preamble = new StringBuilder();
+
+    preamble.append(
+        """
+        #ifndef LF_BINARY_SERIALIZATION_H
+        #define LF_BINARY_SERIALIZATION_H
+        #include <stdint.h>
+        #include <stdlib.h>
+        #include <string.h>
+        // Values are encoded in little-endian byte order with a fixed number of bytes.
+        static inline void lf_binary_write_uint(
+                unsigned char* buffer, uint64_t value, size_t size) {
+            for (size_t i = 0; i < size; i++) {
+                buffer[i] = (unsigned char)(value >> (8 * i));
+            }
+        }
+        static inline uint64_t lf_binary_read_uint(const unsigned char* buffer, size_t size) {
+            uint64_t value = 0;
+            for (size_t i = 0; i < size; i++) {
+                value |= (uint64_t)buffer[i] << (8 * i);
+            }
+            return value;
+        }
+        static inline int64_t lf_binary_read_int(const unsigned char* buffer, size_t size) {
+            // Sign-extend the value to 64 bits.
+            uint64_t sign = (uint64_t)1 << (8 * size - 1);
+            return (int64_t)((lf_binary_read_uint(buffer, size) ^ sign) - sign);
+        }
+        static inline void lf_binary_write_float(unsigned char* buffer, float value) {
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            lf_binary_write_uint(buffer, bits, sizeof(bits));
+        }
+        static inline float lf_binary_read_float(const unsigned char* buffer) {
+            uint32_t bits = (uint32_t)lf_binary_read_uint(buffer, sizeof(bits));
+            float value;
+            memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        static inline void lf_binary_write_double(unsigned char* buffer, double value) {
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            lf_binary_write_uint(buffer, bits, sizeof(bits));
+        }
+        static inline double lf_binary_read_double(const unsigned char* buffer) {
+            uint64_t bits = lf_binary_read_uint(buffer, sizeof(bits));
+            double value;
+            memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        #endif // LF_BINARY_SERIALIZATION_H
+        """);
+
+    return preamble;
+  }
+
+  /**
+   * @return Code that should be appended to the CMakeLists.txt to enable support for binary
+   *     serialization, which is none.
+   */
+  @Override
+  public StringBuilder generateCompilerExtensionForSupport() {
+    return new StringBuilder();
+  }
+}
@@ -8,7 +8,8 @@ package org.lflang.federated.serialization;
 public enum SupportedSerializers {
   NATIVE("native"), // Dangerous: just copies the memory layout of the sender
   ROS2("ros2"),
-  PROTO("proto");
+  PROTO("proto"),
+  BINARY("binary"); // Portable encoding of arithmetic types, arrays, and strings only
 
   private String serializer;
 
@@ -39,9 +39,11 @@ import org.lflang.target.property.BuildTypeProperty;
 import org.lflang.target.property.CmakeIncludeProperty;
 import org.lflang.target.property.CompileDefinitionsProperty;
 import org.lflang.target.property.CompilerProperty;
+import org.lflang.target.property.LtoProperty;
 import org.lflang.target.property.PlatformProperty;
 import org.lflang.target.property.ProtobufsProperty;
 import org.lflang.target.property.SingleThreadedProperty;
+import org.lflang.target.property.UnityBuildProperty;
 import org.lflang.target.property.WorkersProperty;
 import org.lflang.target.property.type.PlatformType.Platform;
 import org.lflang.util.FileUtil;
@@ -93,6 +95,7 @@ public class CCmakeGenerator {
    * will be reported in the 'errorReporter'.
    *
    * @param sources A list of .c files to build.
+   * @param nonUnitySources The sources that must not be merged with other sources in a unity build.
    * @param CppMode Indicate if the compilation should happen in C++ mode
    * @param hasMain Indicate if the .lf file has a main reactor or not. If not, a library target
    *     will be created instead of an executable.
@@ -102,6 +105,7 @@ public class CCmakeGenerator {
    */
   CodeBuilder generateCMakeCode(
       List<String> sources,
+      List<String> nonUnitySources,
       boolean CppMode,
       boolean hasMain,
       String cMakeExtras,
@@ -273,6 +277,24 @@ public class CCmakeGenerator {
               cMakeCode.pr("endif()\n");
             });
 
+    if (targetConfig.getOrDefault(LtoProperty.INSTANCE)) {
+      // Set globally before the runtime library and the main target are declared, so that
+      // reaction bodies, the runtime, and external reaction implementations are optimized together.
+      cMakeCode.pr("# Enable link-time optimization");
+      cMakeCode.pr("include(CheckIPOSupported)");
+      cMakeCode.pr(
+          "check_ipo_supported(RESULT LF_IPO_SUPPORTED OUTPUT LF_IPO_ERROR LANGUAGES "
+              + (CppMode ? "C CXX" : "C")
+              + ")");
+      cMakeCode.pr("if(LF_IPO_SUPPORTED)");
+      cMakeCode.pr("  set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON)");
+      cMakeCode.pr("else()");
+      cMakeCode.pr(
+          "  message(WARNING \"Link-time optimization is not supported: ${LF_IPO_ERROR}\")");
+      cMakeCode.pr("endif()");
+      cMakeCode.newLine();
+    }
+
     // Setup main target for different platforms
     switch (platformOptions.platform()) {
       case ZEPHYR:
@@ -313,6 +335,23 @@ public class CCmakeGenerator {
     cMakeCode.pr("target_include_directories(${LF_MAIN_TARGET} PUBLIC include/core/modal_models)");
     cMakeCode.pr("target_include_directories(${LF_MAIN_TARGET} PUBLIC include/core/utils)");
 
+    if (targetConfig.getOrDefault(UnityBuildProperty.INSTANCE)) {
+      // A batch size of 0 combines all sources of the target into a single translation unit. This
+      // includes sources that are added later, e.g., by a cmake-include file.
+      cMakeCode.pr("# Compile the generated sources as a single translation unit (unity build)");
+      cMakeCode.pr(
+          "set_target_properties(${LF_MAIN_TARGET} PROPERTIES UNITY_BUILD ON"
+              + " UNITY_BUILD_BATCH_SIZE 0)");
+      if (!nonUnitySources.isEmpty()) {
+        cMakeCode.pr("set_source_files_properties(");
+        cMakeCode.indent();
+        nonUnitySources.forEach(cMakeCode::pr);
+        cMakeCode.pr("PROPERTIES SKIP_UNITY_BUILD_INCLUSION ON");
+        cMakeCode.unindent();
+        cMakeCode.pr(")");
+      }
+    }
+
     // post target definition board configurations
     switch (platformOptions.platform()) {
       case RP2040:
@@ -17,7 +17,8 @@ public class CDelayBodyGenerator implements DelayBodyGenerator {
 
   /**
    * Generate code for the body of a reaction that takes an input and schedules an action with the
-   * value of that input.
+   * value of that input. For token types, the token itself is put on the event queue, so the
+   * payload is passed by reference and never copied. Other types are copied into a new token.
    *
    * @param action The action to schedule
    * @param port The port to read from
@@ -32,7 +33,7 @@ public class CDelayBodyGenerator implements DelayBodyGenerator {
   /**
    * Generate code for the body of a reaction that is triggered by the given action and writes its
    * value to the given port. This realizes the receiving end of a logical delay specified with the
-   * 'after' keyword.
+   * 'after' keyword. For token types, the token of the action is handed on to the port.
    *
    * @param action The action that triggers the reaction
    * @param port The port to write to.
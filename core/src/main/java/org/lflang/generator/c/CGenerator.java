@@ -76,7 +76,6 @@ import org.lflang.lf.Action;
 import org.lflang.lf.ActionOrigin;
 import org.lflang.lf.Input;
 import org.lflang.lf.Instantiation;
-import org.lflang.lf.Mode;
 import org.lflang.lf.Port;
 import org.lflang.lf.Preamble;
 import org.lflang.lf.Reaction;
@@ -247,7 +246,9 @@ import org.lflang.util.FileUtil;
  *         <li>This table is accompanied by another list, is_present_fields_abbreviated, which only
  *             contains the is_present fields that have been set to true in the current tag. This
  *             list can allow a performance improvement if most ports are seldom present because
- *             only fields that have been set to true need to be reset to false.
+ *             only fields that have been set to true need to be reset to false. The full table is
+ *             only swept if this list overflows. Generated code must therefore never set an
+ *             is_present field directly, but use lf_set_present(), which records the field.
  *       </ul>
  *   <li>_lf_shutdown_triggers: An array of pointers to trigger_t structs for shutdown reactions.
  *       The length of this table is in the _lf_shutdown_triggers_size variable.
@@ -456,8 +457,20 @@ public class CGenerator extends GeneratorBase {
               .map(it -> it + (cppMode ? ".cpp" : ".c"))
               .collect(Collectors.toCollection(ArrayList::new));
       sources.add(cFilename);
+      // Preambles and the type arguments of generic reactors are not scoped to a single source
+      // file, so such sources are compiled separately in a unity build.
+      var nonUnitySources =
+          allTypeParameterizedReactors()
+              .filter(
+                  it ->
+                      !it.reactor().getTypeParms().isEmpty()
+                          || !ASTUtils.allPreambles(it.reactor()).isEmpty())
+              .map(CUtil::getName)
+              .map(it -> it + (cppMode ? ".cpp" : ".c"))
+              .toList();
       var cmakeCode =
-          cmakeGenerator.generateCMakeCode(sources, cppMode, mainDef != null, cMakeExtras, context);
+          cmakeGenerator.generateCMakeCode(
+              sources, nonUnitySources, cppMode, mainDef != null, cMakeExtras, context);
       try {
         cmakeCode.writeToFile(cmakeFile);
       } catch (IOException e) {
@@ -1325,12 +1338,14 @@ public class CGenerator extends GeneratorBase {
   public void generateReactions(CodeBuilder src, TypeParameterizedReactor tpr) {
     var reactionIndex = 0;
     var reactor = ASTUtils.toDefinition(tpr.reactor());
+    src.pr(CTracingGenerator.generateUserTraceSuppression(tpr, main, targetConfig));
     for (Reaction reaction : allReactions(reactor)) {
       generateReaction(src, reaction, tpr, reactionIndex);
       // Increment reaction index even if the reaction is not in the federate
       // so that across federates, the reaction indices are consistent.
       reactionIndex++;
     }
+    src.pr(CTracingGenerator.generateUserTraceRestoration(tpr, main, targetConfig));
   }
 
   /**
@@ -1399,7 +1414,8 @@ public class CGenerator extends GeneratorBase {
           foundOne = true;
           enclaveInfo.numShutdownReactions += reactor.getTotalWidth();
 
-          if (targetConfig.get(TracingProperty.INSTANCE).isEnabled()) {
+          if (targetConfig.get(TracingProperty.INSTANCE).isEnabled()
+              && CTracingGenerator.isTraced(reactor)) {
             var description = CUtil.getShortenedName(reactor);
             var reactorRef = CUtil.reactorRef(reactor);
             temp.pr(
@@ -1823,18 +1839,13 @@ public class CGenerator extends GeneratorBase {
     var selfRef = CUtil.reactorRef(instance);
     for (StateVar stateVar : allStateVars(toDefinition(reactorClass))) {
       if (isInitialized(stateVar)) {
-        var mode =
-            stateVar.eContainer() instanceof Mode
-                ? instance.lookupModeInstance((Mode) stateVar.eContainer())
-                : instance.getMode(false);
         initializeTriggerObjects.pr(
-            CStateGenerator.generateInitializer(instance, selfRef, stateVar, mode, types));
-        if (mode != null && stateVar.isReset()) {
-          CUtil.getClosestEnclave(instance).enclaveInfo.numModalResetStates +=
-              instance.getTotalWidth();
-        }
+            CStateGenerator.generateInitializer(instance, selfRef, stateVar, types));
       }
     }
+    initializeTriggerObjects.pr(CStateGenerator.generateModalResets(instance, selfRef));
+    CUtil.getClosestEnclave(instance).enclaveInfo.numModalResetStates +=
+        CStateGenerator.countModalResets(instance) * instance.getTotalWidth();
   }
 
   /**
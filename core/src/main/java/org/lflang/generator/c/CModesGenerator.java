@@ -134,52 +134,25 @@ public class CModesGenerator {
   }
 
   /**
-   * Generate code registering a state variable for automatic reset.
+   * Generate code registering a block of state variables for automatic reset.
    *
    * @param modeRef The code to refer to the mode
-   * @param selfRef The code to refer to the self struct
-   * @param varName The variable name in the self struct
-   * @param source The variable that stores the initial value
-   * @param type The size of the initial value
+   * @param target The code to refer to the first byte of the block in the self struct
+   * @param source The code to refer to the initial values of the block
+   * @param size The size of the block
    */
   public static String generateStateResetStructure(
-      ReactorInstance instance,
-      String modeRef,
-      String selfRef,
-      String varName,
-      String source,
-      String type) {
+      ReactorInstance instance, String modeRef, String target, String source, String size) {
     var env = CUtil.getEnvironmentStruct(instance);
     var envId = CUtil.getEnvironmentId(instance);
+    var entry = env + ".modes->state_resets[modal_state_reset_count[" + envId + "]]";
     return String.join(
         "\n",
         "// Register for automatic reset",
-        env
-            + ".modes->state_resets[modal_state_reset_count["
-            + envId
-            + "]].mode = "
-            + modeRef
-            + ";",
-        env
-            + ".modes->state_resets[modal_state_reset_count["
-            + envId
-            + "]].target = &("
-            + selfRef
-            + "->"
-            + varName
-            + ");",
-        env
-            + ".modes->state_resets[modal_state_reset_count["
-            + envId
-            + "]].source = &"
-            + source
-            + ";",
-        env
-            + ".modes->state_resets[modal_state_reset_count["
-            + envId
-            + "]].size = sizeof("
-            + type
-            + ");",
+        entry + ".mode = " + modeRef + ";",
+        entry + ".target = " + target + ";",
+        entry + ".source = " + source + ";",
+        entry + ".size = " + size + ";",
         "modal_state_reset_count[" + envId + "]++;");
   }
 }
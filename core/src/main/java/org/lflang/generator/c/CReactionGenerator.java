@@ -350,7 +350,8 @@ public class CReactionGenerator {
                 + ", (lf_token_t*)self->_lf__"
                 + actionName
                 + ".tmplt.token);",
-            "self->_lf_" + outputName + ".is_present = true;",
+            "// Record the port in the list of present fields, so that only it is reset at the next tag.",
+            "lf_set_present(&self->_lf_" + outputName + ");",
             "lf_critical_section_exit(self->base.environment);")
         : "lf_set(" + outputName + ", " + actionName + "->value);";
   }
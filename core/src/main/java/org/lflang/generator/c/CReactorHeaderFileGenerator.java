@@ -13,7 +13,6 @@ import org.lflang.lf.LfFactory;
 import org.lflang.lf.Parameter;
 import org.lflang.lf.Reaction;
 import org.lflang.lf.Reactor;
-import org.lflang.lf.StateVar;
 import org.lflang.lf.TriggerRef;
 import org.lflang.lf.TypedVariable;
 import org.lflang.lf.VarRef;
@@ -110,9 +109,8 @@ public class CReactorHeaderFileGenerator {
     for (Parameter p : tpr.reactor().getParameters()) {
       builder.pr(types.getTargetType(p) + " " + p.getName() + ";");
     }
-    for (StateVar s : tpr.reactor().getStateVars()) {
-      builder.pr(types.getTargetType(s) + " " + s.getName() + ";");
-    }
+    // Mirror the layout of the state variables in the self struct, including reset groups.
+    builder.pr(CStateGenerator.generateDeclarations(tpr, types, true));
     builder.pr("int end[0]; // placeholder; MSVC does not compile empty structs");
     builder.unindent();
     builder.pr("} " + userFacingSelfType(tpr) + ";");
@@ -1,15 +1,26 @@
 package org.lflang.generator.c;
 
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import org.eclipse.emf.ecore.EObject;
 import org.lflang.ast.ASTUtils;
 import org.lflang.generator.CodeBuilder;
 import org.lflang.generator.ModeInstance;
 import org.lflang.generator.ReactorInstance;
+import org.lflang.lf.Mode;
+import org.lflang.lf.Reactor;
 import org.lflang.lf.StateVar;
 
 public class CStateGenerator {
   /**
    * Generate code for state variables of a reactor in the form "stateVar.type stateVar.name;"
    *
+   * <p>State variables that are reset together on a mode transition are grouped into an anonymous
+   * struct, so that they are contiguous in the self struct and can be reset with a single copy.
+   * Each group is followed by a struct with the same layout that holds the initial values.
+   *
    * @param reactor {@link TypeParameterizedReactor}
    * @param types A helper object for types
    * @param suppressLineDirectives Whether to suppress the generation of line directives.
@@ -17,18 +28,46 @@ public class CStateGenerator {
   public static String generateDeclarations(
       TypeParameterizedReactor reactor, CTypes types, boolean suppressLineDirectives) {
     CodeBuilder code = new CodeBuilder();
+    var groups = resetGroups(reactor.reactor());
     for (StateVar stateVar : ASTUtils.allStateVars(reactor.reactor())) {
-      code.prSourceLineNumber(stateVar, suppressLineDirectives);
-      code.pr(
-          types.getTargetType(reactor.resolveType(ASTUtils.getInferredType(stateVar)))
-              + " "
-              + stateVar.getName()
-              + ";");
+      if (!isReset(stateVar)) {
+        code.pr(generateDeclaration(reactor, stateVar, types, suppressLineDirectives));
+      }
+    }
+    var index = 0;
+    for (List<StateVar> group : groups.values()) {
+      var members = new CodeBuilder();
+      members.indent();
+      for (StateVar stateVar : group) {
+        members.pr(generateDeclaration(reactor, stateVar, types, suppressLineDirectives));
+      }
+      members.prEndSourceLineNumber(suppressLineDirectives);
+      code.pr("struct {");
+      code.pr(members.toString());
+      code.pr("};");
+      code.pr("struct {");
+      code.pr(members.toString());
+      code.pr("} " + initialValuesName(index++) + ";");
     }
     code.prEndSourceLineNumber(suppressLineDirectives);
     return code.toString();
   }
 
+  private static String generateDeclaration(
+      TypeParameterizedReactor reactor,
+      StateVar stateVar,
+      CTypes types,
+      boolean suppressLineDirectives) {
+    CodeBuilder code = new CodeBuilder();
+    code.prSourceLineNumber(stateVar, suppressLineDirectives);
+    code.pr(
+        types.getTargetType(reactor.resolveType(ASTUtils.getInferredType(stateVar)))
+            + " "
+            + stateVar.getName()
+            + ";");
+    return code.toString();
+  }
+
   /**
    * If the state is initialized with a parameter, then do not use a temporary variable. Otherwise,
    * do, because static initializers for arrays and structs have to be handled this way, and there
@@ -36,33 +75,17 @@ public class CStateGenerator {
    *
    * @param instance {@link ReactorInstance}
    * @param stateVar {@link StateVar}
-   * @param mode {@link ModeInstance}
    * @return String
    */
   public static String generateInitializer(
-      ReactorInstance instance,
-      String selfRef,
-      StateVar stateVar,
-      ModeInstance mode,
-      CTypes types) {
+      ReactorInstance instance, String selfRef, StateVar stateVar, CTypes types) {
     var initExpr = getInitializerExpr(stateVar, instance);
-    String baseInitializer =
-        generateBaseInitializer(instance.tpr, selfRef, stateVar, initExpr, types);
-    String modalReset = generateModalReset(instance, selfRef, stateVar, initExpr, mode, types);
-    return String.join("\n", baseInitializer, modalReset);
-  }
-
-  private static String generateBaseInitializer(
-      TypeParameterizedReactor tpr,
-      String selfRef,
-      StateVar stateVar,
-      String initExpr,
-      CTypes types) {
     if (ASTUtils.isOfTimeType(stateVar) || ASTUtils.isParameterized(stateVar)) {
       return selfRef + "->" + stateVar.getName() + " = " + initExpr + ";";
     } else {
       var declaration =
-          types.getVariableDeclaration(tpr, ASTUtils.getInferredType(stateVar), "_initial", true);
+          types.getVariableDeclaration(
+              instance.tpr, ASTUtils.getInferredType(stateVar), "_initial", true);
       return String.join(
           "\n",
           "{ // For scoping",
@@ -72,43 +95,90 @@ public class CStateGenerator {
     }
   }
 
-  private static String generateModalReset(
-      ReactorInstance instance,
-      String selfRef,
-      StateVar stateVar,
-      String initExpr,
-      ModeInstance mode,
-      CTypes types) {
-    if (mode == null || !stateVar.isReset()) {
-      return "";
-    }
-    var modeRef =
-        "&"
-            + CUtil.reactorRef(mode.getParent())
-            + "->_lf__modes["
-            + mode.getParent().modes.indexOf(mode)
-            + "]";
-    var type = types.getTargetType(instance.tpr.resolveType(ASTUtils.getInferredType(stateVar)));
-
-    if (ASTUtils.isParameterized(stateVar)) {
-      return CModesGenerator.generateStateResetStructure(
-          instance, modeRef, selfRef, stateVar.getName(), initExpr, type);
-    } else {
-      CodeBuilder code = new CodeBuilder();
-      var source = "_initial";
-      var declaration =
-          types.getVariableDeclaration(
-              instance.tpr, ASTUtils.getInferredType(stateVar), source, true);
-      code.pr("{ // For scoping");
-      code.indent();
-      code.pr("static " + declaration + " = " + initExpr + ";");
+  /**
+   * Generate code that records the initial values of the reset state variables of the given
+   * instance and registers each group of them for automatic reset with its mode. This has to be
+   * executed after the state variables have been initialized.
+   *
+   * @param instance {@link ReactorInstance}
+   * @param selfRef The code to refer to the self struct
+   */
+  public static String generateModalResets(ReactorInstance instance, String selfRef) {
+    CodeBuilder code = new CodeBuilder();
+    var index = 0;
+    for (var entry : resetGroups(instance.reactorDefinition).entrySet()) {
+      var initialValues = selfRef + "->" + initialValuesName(index++);
+      var mode = resetMode(instance, entry.getKey());
+      if (mode == null) {
+        continue;
+      }
+      var modeRef =
+          "&"
+              + CUtil.reactorRef(mode.getParent())
+              + "->_lf__modes["
+              + mode.getParent().modes.indexOf(mode)
+              + "]";
+      for (StateVar stateVar : entry.getValue()) {
+        code.pr(
+            initialValues
+                + "."
+                + stateVar.getName()
+                + " = "
+                + selfRef
+                + "->"
+                + stateVar.getName()
+                + ";");
+      }
       code.pr(
           CModesGenerator.generateStateResetStructure(
-              instance, modeRef, selfRef, stateVar.getName(), source, type));
-      code.unindent();
-      code.pr("} // End scoping.");
-      return code.toString();
+              instance,
+              modeRef,
+              "&(" + selfRef + "->" + entry.getValue().get(0).getName() + ")",
+              "&(" + initialValues + ")",
+              "sizeof(" + initialValues + ")"));
+    }
+    return code.toString();
+  }
+
+  /**
+   * Return the number of entries that {@link #generateModalResets(ReactorInstance, String)}
+   * registers for each runtime instance of the given reactor instance.
+   */
+  public static int countModalResets(ReactorInstance instance) {
+    return (int)
+        resetGroups(instance.reactorDefinition).keySet().stream()
+            .filter(it -> resetMode(instance, it) != null)
+            .count();
+  }
+
+  /**
+   * Return the initialized reset state variables of the given reactor, grouped by the mode they
+   * are declared in, or by the reactor itself for state variables declared outside of modes.
+   */
+  private static Map<EObject, List<StateVar>> resetGroups(Reactor reactor) {
+    var groups = new LinkedHashMap<EObject, List<StateVar>>();
+    for (StateVar stateVar : ASTUtils.allStateVars(reactor)) {
+      if (isReset(stateVar)) {
+        var container = stateVar.eContainer() instanceof Mode ? stateVar.eContainer() : reactor;
+        groups.computeIfAbsent(container, it -> new ArrayList<>()).add(stateVar);
+      }
     }
+    return groups;
+  }
+
+  /** Return the mode that resets the given group, or null if the group is never reset. */
+  private static ModeInstance resetMode(ReactorInstance instance, EObject container) {
+    return container instanceof Mode mode
+        ? instance.lookupModeInstance(mode)
+        : instance.getMode(false);
+  }
+
+  private static boolean isReset(StateVar stateVar) {
+    return stateVar.isReset() && ASTUtils.isInitialized(stateVar);
+  }
+
+  private static String initialValuesName(int group) {
+    return "_lf__reset_" + group + "_initial";
   }
 
   /**
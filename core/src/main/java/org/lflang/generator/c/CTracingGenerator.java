@@ -4,9 +4,12 @@ import static org.lflang.util.StringUtil.addDoubleQuotes;
 
 import java.util.ArrayList;
 import java.util.List;
+import org.lflang.AttributeUtils;
 import org.lflang.generator.ActionInstance;
 import org.lflang.generator.ReactorInstance;
 import org.lflang.generator.TimerInstance;
+import org.lflang.target.TargetConfig;
+import org.lflang.target.property.TracingProperty;
 
 /**
  * Generates C code to support tracing.
@@ -22,16 +25,23 @@ public class CTracingGenerator {
    *
    * <p>If tracing is turned on, record the address of this reaction in the
    * _lf_trace_object_descriptions table that is used to generate the header information in the
-   * trace file.
+   * trace file. Nothing is recorded for instances that are excluded from tracing (see {@link
+   * #isTraced(ReactorInstance)}).
    *
    * @param instance The reactor instance.
    */
   public static String generateTraceTableEntries(ReactorInstance instance) {
+    if (!isTraced(instance)) {
+      return "";
+    }
     List<String> code = new ArrayList<>();
     var description = CUtil.getShortenedName(instance);
     var selfStruct = CUtil.reactorRef(instance);
     code.add(registerTraceEvent(selfStruct, "NULL", "trace_reactor", description));
     for (ActionInstance action : instance.actions) {
+      if (Boolean.FALSE.equals(AttributeUtils.getTraceAttribute(action.getDefinition()))) {
+        continue;
+      }
       code.add(
           registerTraceEvent(
               selfStruct,
@@ -40,6 +50,9 @@ public class CTracingGenerator {
               description + "." + action.getName()));
     }
     for (TimerInstance timer : instance.timers) {
+      if (Boolean.FALSE.equals(AttributeUtils.getTraceAttribute(timer.getDefinition()))) {
+        continue;
+      }
       code.add(
           registerTraceEvent(
               selfStruct,
@@ -50,6 +63,90 @@ public class CTracingGenerator {
     return String.join("\n", code);
   }
 
+  /**
+   * Return true if the given reactor instance is selected for tracing.
+   *
+   * <p>A {@code @trace(false)} attribute on an instantiation or on a reactor class excludes all
+   * instances in the subtree from tracing, and {@code @trace} selects them again. The attribute
+   * that is closest to the instance takes precedence, where the attribute of an instantiation
+   * overrides the attribute of its reactor class. Without any attribute, all instances are traced.
+   * Individual actions and timers can be excluded with {@code @trace(false)} as well.
+   *
+   * @param instance The reactor instance.
+   */
+  public static boolean isTraced(ReactorInstance instance) {
+    for (var current = instance; current != null; current = current.getParent()) {
+      var selected = AttributeUtils.getTraceAttribute(current.getDefinition());
+      if (selected == null) {
+        selected = AttributeUtils.getTraceAttribute(current.reactorDefinition);
+      }
+      if (selected != null) {
+        return selected;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Return true if at least one instance of the given reactor class in the program is selected for
+   * tracing, or if the program has no main reactor.
+   *
+   * @param tpr The reactor class.
+   * @param main The main reactor instance, or null.
+   */
+  public static boolean isTraced(TypeParameterizedReactor tpr, ReactorInstance main) {
+    if (main == null) {
+      return true;
+    }
+    if (main.tpr.equals(tpr) && isTraced(main)) {
+      return true;
+    }
+    return main.children.stream().anyMatch(child -> isTraced(tpr, child));
+  }
+
+  /**
+   * Generate the code that precedes the reaction functions of the given reactor class. If tracing
+   * is turned on and no instance of the class is selected for tracing, the user trace events of its
+   * reactions are compiled out. The reactions and triggers of excluded instances are left out of
+   * the trace table by {@link #generateTraceTableEntries(ReactorInstance)}.
+   *
+   * @param tpr The reactor class.
+   * @param main The main reactor instance, or null.
+   * @param targetConfig The target configuration.
+   */
+  public static String generateUserTraceSuppression(
+      TypeParameterizedReactor tpr, ReactorInstance main, TargetConfig targetConfig) {
+    if (!targetConfig.get(TracingProperty.INSTANCE).isEnabled() || isTraced(tpr, main)) {
+      return "";
+    }
+    return """
+        // No instance of this reactor is traced, so its reactions record no user trace events.
+        #define register_user_trace_event(self, description) (1)
+        #define tracepoint_user_event(self, description) ((void)0)
+        #define tracepoint_user_value(self, description, value) ((void)0)
+        """;
+  }
+
+  /**
+   * Generate the code that follows the reaction functions of the given reactor class and undoes
+   * {@link #generateUserTraceSuppression(TypeParameterizedReactor, ReactorInstance, TargetConfig)}.
+   *
+   * @param tpr The reactor class.
+   * @param main The main reactor instance, or null.
+   * @param targetConfig The target configuration.
+   */
+  public static String generateUserTraceRestoration(
+      TypeParameterizedReactor tpr, ReactorInstance main, TargetConfig targetConfig) {
+    if (!targetConfig.get(TracingProperty.INSTANCE).isEnabled() || isTraced(tpr, main)) {
+      return "";
+    }
+    return """
+        #undef register_user_trace_event
+        #undef tracepoint_user_event
+        #undef tracepoint_user_value
+        """;
+  }
+
   private static String registerTraceEvent(
       String obj, String trigger, String type, String description) {
     return "_lf_register_trace_event("
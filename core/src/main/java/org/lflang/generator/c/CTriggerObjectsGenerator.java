@@ -10,8 +10,11 @@ import static org.lflang.util.StringUtil.addDoubleQuotes;
 import static org.lflang.util.StringUtil.joinObjects;
 
 import com.google.common.collect.Iterables;
+import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.HashSet;
+import java.util.LinkedHashMap;
+import java.util.List;
 import java.util.stream.Collectors;
 import org.lflang.AttributeUtils;
 import org.lflang.ast.ASTUtils;
@@ -411,104 +414,74 @@ public class CTriggerObjectsGenerator {
    * reaction struct to point to the single dominating upstream reaction if there is one, or to be
    * NULL if there is none.
    *
+   * <p>Runtime instances are grouped by their dominating reaction. For each group, the indices of
+   * the runtime instances and of their dominating runtime instances are emitted as constant tables
+   * that are traversed by a loop. This keeps the generated code proportional to the number of
+   * reactions rather than to the number of bank members.
+   *
    * @param r The reactor.
    */
   private static String deferredOptimizeForSingleDominatingReaction(ReactorInstance r) {
     var code = new CodeBuilder();
     for (ReactionInstance reaction : r.reactions) {
-      // The following code attempts to gather into a loop assignments of successive
-      // bank members relations between reactions to avoid large chunks of inline code
-      // when a large bank sends to a large bank or when a large bank receives from
-      // one reaction that is either multicasting or sending through a multiport.
-      var start = 0;
-      var end = 0;
-      var domStart = 0;
-      var same = false; // Set to true when finding a string of identical dominating reactions.
-      ReactionInstance.Runtime previousRuntime = null;
-      var first = true; // First time through the loop.
+      var groups = new LinkedHashMap<ReactionInstance, List<ReactionInstance.Runtime>>();
       for (ReactionInstance.Runtime runtime : reaction.getRuntimeInstances()) {
-        if (!first) { // Not the first time through the loop.
-          if (same) { // Previously seen at least two identical dominating.
-            if (runtime.dominating != previousRuntime.dominating) {
-              // End of streak of same dominating reaction runtime instance.
-              code.pr(
-                  printOptimizeForSingleDominatingReaction(
-                      previousRuntime, start, end, domStart, same));
-              same = false;
-              start = runtime.id;
-              domStart = (runtime.dominating != null) ? runtime.dominating.id : 0;
-            }
-          } else if (runtime.dominating == previousRuntime.dominating) {
-            // Start of a streak of identical dominating reaction runtime instances.
-            same = true;
-          } else if (runtime.dominating != null
-              && previousRuntime.dominating != null
-              && runtime.dominating.getReaction() == previousRuntime.dominating.getReaction()) {
-            // Same dominating reaction even if not the same dominating runtime.
-            if (runtime.dominating.id != previousRuntime.dominating.id + 1) {
-              // End of a streak of contiguous runtimes.
-              printOptimizeForSingleDominatingReaction(previousRuntime, start, end, domStart, same);
-              same = false;
-              start = runtime.id;
-              domStart = runtime.dominating.id;
-            }
-          } else {
-            // Different dominating reaction.
-            printOptimizeForSingleDominatingReaction(previousRuntime, start, end, domStart, same);
-            same = false;
-            start = runtime.id;
-            domStart = (runtime.dominating != null) ? runtime.dominating.id : 0;
-          }
-        }
-        first = false;
-        previousRuntime = runtime;
-        end++;
-      }
-      if (end > start) {
-        printOptimizeForSingleDominatingReaction(previousRuntime, start, end, domStart, same);
+        var dominating = runtime.dominating != null ? runtime.dominating.getReaction() : null;
+        groups.computeIfAbsent(dominating, k -> new ArrayList<>()).add(runtime);
       }
+      groups.forEach(
+          (dominating, runtimes) ->
+              code.pr(printOptimizeForSingleDominatingReaction(dominating, runtimes)));
     }
     return code.toString();
   }
 
-  /** Print statement that sets the last_enabling_reaction field of a reaction. */
+  /**
+   * Print statements that set the last_enabling_reaction field of the given runtime instances,
+   * which all have the given dominating reaction (or none if it is null).
+   */
   private static String printOptimizeForSingleDominatingReaction(
-      ReactionInstance.Runtime runtime, int start, int end, int domStart, boolean same) {
+      ReactionInstance dominating, List<ReactionInstance.Runtime> runtimes) {
     var code = new CodeBuilder();
-    var dominatingRef = "NULL";
-
-    if (end > start + 1) {
-      code.startScopedBlock();
-      var reactionRef = CUtil.reactionRef(runtime.getReaction(), "i");
-      if (runtime.dominating != null) {
-        if (same) {
-          dominatingRef =
-              "&(" + CUtil.reactionRef(runtime.dominating.getReaction(), "" + domStart) + ")";
-        } else {
-          dominatingRef = "&(" + CUtil.reactionRef(runtime.dominating.getReaction(), "j++") + ")";
-        }
-      }
+    var reaction = runtimes.get(0).getReaction();
+    code.pr("// " + reaction.getFullName() + " dominating upstream reaction.");
+    if (runtimes.size() == 1) {
+      var runtime = runtimes.get(0);
+      var dominatingRef =
+          dominating != null
+              ? "&(" + CUtil.reactionRef(dominating, "" + runtime.dominating.id) + ")"
+              : "NULL";
       code.pr(
-          String.join(
-              "\n",
-              "// " + runtime.getReaction().getFullName() + " dominating upstream reaction.",
-              "int j = " + domStart + ";",
-              "for (int i = " + start + "; i < " + end + "; i++) {",
-              "    " + reactionRef + ".last_enabling_reaction = " + dominatingRef + ";",
-              "}"));
-      code.endScopedBlock();
-    } else if (end == start + 1) {
-      var reactionRef = CUtil.reactionRef(runtime.getReaction(), "" + start);
-      if (runtime.dominating != null) {
-        dominatingRef =
-            "&(" + CUtil.reactionRef(runtime.dominating.getReaction(), "" + domStart) + ")";
-      }
+          CUtil.reactionRef(reaction, "" + runtime.id)
+              + ".last_enabling_reaction = "
+              + dominatingRef
+              + ";");
+      return code.toString();
+    }
+    code.startScopedBlock();
+    code.pr(
+        "static const int runtime_ids[] = { "
+            + joinObjects(runtimes.stream().map(it -> it.id).toList(), ", ")
+            + " };");
+    var dominatingRef = "NULL";
+    if (dominating != null) {
       code.pr(
-          String.join(
-              "\n",
-              "// " + runtime.getReaction().getFullName() + " dominating upstream reaction.",
-              reactionRef + ".last_enabling_reaction = " + dominatingRef + ";"));
+          "static const int dominating_ids[] = { "
+              + joinObjects(runtimes.stream().map(it -> it.dominating.id).toList(), ", ")
+              + " };");
+      dominatingRef = "&(" + CUtil.reactionRef(dominating, "dominating_ids[i]") + ")";
     }
+    code.pr(
+        String.join(
+            "\n",
+            "for (int i = 0; i < " + runtimes.size() + "; i++) {",
+            "    "
+                + CUtil.reactionRef(reaction, "runtime_ids[i]")
+                + ".last_enabling_reaction = "
+                + dominatingRef
+                + ";",
+            "}"));
+    code.endScopedBlock();
     return code.toString();
   }
 
@@ -523,8 +496,6 @@ public class CTriggerObjectsGenerator {
     for (ReactionInstance reaction : reactions) {
       var name = reaction.getParent().getFullName();
 
-      var reactorSelfStruct = CUtil.reactorRef(reaction.getParent(), sr);
-
       var foundPort = false;
 
       for (PortInstance port : Iterables.filter(reaction.effects, PortInstance.class)) {
@@ -535,6 +506,7 @@ public class CTriggerObjectsGenerator {
               "int triggers_index["
                   + reaction.getParent().getTotalWidth()
                   + "] = { 0 }; // Number of bank members with the reaction.");
+          code.pr(allocateTriggerPool(reaction));
           foundPort = true;
         }
         // If the port is a multiport, then its channels may have different sets
@@ -568,12 +540,12 @@ public class CTriggerObjectsGenerator {
                       + "]] = "
                       + srcRange.destinations.size()
                       + ";",
-                  "// For reaction " + reaction.index + " of " + name + ", allocate an",
-                  "// array of trigger pointers for downstream reactions through port "
-                      + port.getFullName(),
-                  "trigger_t** trigger_array = (trigger_t**)lf_allocate(",
-                  "        " + srcRange.destinations.size() + ", sizeof(trigger_t*),",
-                  "        &" + reactorSelfStruct + "->base.allocations); ",
+                  "// For reaction " + reaction.index + " of " + name + ", take the next",
+                  "// trigger pointers for downstream reactions through port "
+                      + port.getFullName()
+                      + " from the pool.",
+                  "trigger_t** trigger_array = trigger_pool + trigger_pool_next;",
+                  "trigger_pool_next += " + srcRange.destinations.size() + ";",
                   triggerArray + " = trigger_array;"));
           code.endScopedRangeBlock(srcRange);
         }
@@ -676,6 +648,33 @@ public class CTriggerObjectsGenerator {
     return code.toString();
   }
 
+  /**
+   * Allocate a single array that holds the trigger pointers of all output channels of the given
+   * reaction for all its runtime instances. The triggers array of the reaction points into this
+   * pool, so that the destinations of successive channels are adjacent in memory, like the column
+   * indices of a compressed sparse row matrix. This avoids chasing separately allocated arrays
+   * when setting wide multiports.
+   *
+   * @param reaction The reaction.
+   */
+  private static String allocateTriggerPool(ReactionInstance reaction) {
+    var poolSize = 0;
+    for (PortInstance port : Iterables.filter(reaction.effects, PortInstance.class)) {
+      for (SendRange srcRange : port.eventualDestinations()) {
+        poolSize += srcRange.destinations.size() * srcRange.width;
+      }
+    }
+    if (poolSize == 0) return "";
+    return String.join(
+        "\n",
+        "// Pool of trigger pointers for all downstream reactions of " + reaction + ".",
+        "trigger_t** trigger_pool = (trigger_t**)lf_allocate(",
+        "        " + poolSize + ", sizeof(trigger_t*),",
+        "        &" + CUtil.reactorRef(reaction.getParent(), "0") + "->base.allocations);",
+        "size_t trigger_pool_next = 0;",
+        "SUPPRESS_UNUSED_WARNING(trigger_pool_next);");
+  }
+
   /**
    * For each input port of a contained reactor that receives data from one or more of the specified
    * reactions, set the num_destinations field of the corresponding port structs on the self struct
@@ -808,6 +807,12 @@ public class CTriggerObjectsGenerator {
    * have been created. This function does not create nested loops over nested banks, so each
    * function it calls must handle its own iteration over all runtime instance.
    *
+   * <p>The functions that iterate over send ranges emit one loop per range, and a range covers any
+   * number of bank members and channels, including interleaved ones, through its mixed-radix
+   * permutation. Their code therefore grows with the number of connections, not with the widths of
+   * banks and multiports. Assignments that depend on the individual runtime instance, like the
+   * dominating reactions, are emitted as constant tables instead.
+   *
    * @param reactor The container.
    * @param main The top-level reactor.
    * @param reactions The list of reactions to consider.
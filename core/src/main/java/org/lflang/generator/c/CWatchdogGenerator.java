@@ -49,7 +49,8 @@ public class CWatchdogGenerator {
    * For the specified reactor instance, generate initialization code for each watchdog in the
    * reactor. This code initializes the watchdog-related fields on the self struct of the reactor
    * instance. It also increments the watchdog count in the environment the parent reactor instance
-   * is within.
+   * is within. The code is executed once for each bank member, so every member of a bank and of
+   * the banks that contain it is counted.
    *
    * @param code The place to put the code
    * @param instance The reactor instance
@@ -94,7 +95,7 @@ public class CWatchdogGenerator {
     if (foundOne) {
       code.pr(temp.toString());
     }
-    enclaveInfo.numWatchdogs += watchdogCount;
+    enclaveInfo.numWatchdogs += watchdogCount * instance.getTotalWidth();
   }
 
   /**
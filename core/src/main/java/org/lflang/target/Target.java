@@ -36,6 +36,7 @@ import org.lflang.target.property.ClockSyncOptionsProperty;
 import org.lflang.target.property.CmakeIncludeProperty;
 import org.lflang.target.property.CompileDefinitionsProperty;
 import org.lflang.target.property.CompilerProperty;
+import org.lflang.target.property.ConstexprParametersProperty;
 import org.lflang.target.property.CoordinationOptionsProperty;
 import org.lflang.target.property.CoordinationProperty;
 import org.lflang.target.property.DockerProperty;
@@ -44,20 +45,26 @@ import org.lflang.target.property.ExportToYamlProperty;
 import org.lflang.target.property.ExternalRuntimePathProperty;
 import org.lflang.target.property.FilesProperty;
 import org.lflang.target.property.KeepaliveProperty;
+import org.lflang.target.property.LtoProperty;
 import org.lflang.target.property.NoRuntimeValidationProperty;
 import org.lflang.target.property.NoSourceMappingProperty;
+import org.lflang.target.property.PgoProperty;
 import org.lflang.target.property.PlatformProperty;
+import org.lflang.target.property.PrecompiledHeadersProperty;
 import org.lflang.target.property.PrintStatisticsProperty;
 import org.lflang.target.property.ProtobufsProperty;
 import org.lflang.target.property.Ros2DependenciesProperty;
 import org.lflang.target.property.Ros2Property;
+import org.lflang.target.property.RuntimeCacheProperty;
 import org.lflang.target.property.RuntimeVersionProperty;
 import org.lflang.target.property.RustIncludeProperty;
 import org.lflang.target.property.SchedulerProperty;
 import org.lflang.target.property.SingleFileProjectProperty;
 import org.lflang.target.property.SingleThreadedProperty;
+import org.lflang.target.property.TargetCpuProperty;
 import org.lflang.target.property.TracePluginProperty;
 import org.lflang.target.property.TracingProperty;
+import org.lflang.target.property.UnityBuildProperty;
 import org.lflang.target.property.VerifyProperty;
 import org.lflang.target.property.WorkersProperty;
 
@@ -603,6 +610,7 @@ public enum Target {
           DockerProperty.INSTANCE,
           FilesProperty.INSTANCE,
           KeepaliveProperty.INSTANCE,
+          LtoProperty.INSTANCE,
           NoSourceMappingProperty.INSTANCE,
           PlatformProperty.INSTANCE,
           ProtobufsProperty.INSTANCE,
@@ -610,21 +618,29 @@ public enum Target {
           SingleThreadedProperty.INSTANCE,
           TracingProperty.INSTANCE,
           TracePluginProperty.INSTANCE,
+          UnityBuildProperty.INSTANCE,
           VerifyProperty.INSTANCE,
           WorkersProperty.INSTANCE);
       case CPP -> config.register(
           BuildTypeProperty.INSTANCE,
           CmakeIncludeProperty.INSTANCE,
           CompilerProperty.INSTANCE,
+          ConstexprParametersProperty.INSTANCE,
           ExportDependencyGraphProperty.INSTANCE,
           ExportToYamlProperty.INSTANCE,
           ExternalRuntimePathProperty.INSTANCE,
+          LtoProperty.INSTANCE,
           NoRuntimeValidationProperty.INSTANCE,
+          PgoProperty.INSTANCE,
+          PrecompiledHeadersProperty.INSTANCE,
           PrintStatisticsProperty.INSTANCE,
           Ros2DependenciesProperty.INSTANCE,
           Ros2Property.INSTANCE,
+          RuntimeCacheProperty.INSTANCE,
           RuntimeVersionProperty.INSTANCE,
+          TargetCpuProperty.INSTANCE,
           TracingProperty.INSTANCE,
+          UnityBuildProperty.INSTANCE,
           WorkersProperty.INSTANCE);
       case Python -> config.register(
           AuthProperty.INSTANCE,
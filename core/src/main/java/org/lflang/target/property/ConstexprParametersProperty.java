@@ -0,0 +1,22 @@
+package org.lflang.target.property;
+
+/**
+ * If true, parameters that have the same statically known value in all instances of a reactor are
+ * generated as compile-time constants. This allows the compiler to fold and vectorize code in
+ * reaction bodies that depends on such parameters. Parameters of the main reactor that are
+ * specialized this way can no longer be overridden on the command line. The default is false.
+ */
+public final class ConstexprParametersProperty extends BooleanProperty {
+
+  /** Singleton target property instance. */
+  public static final ConstexprParametersProperty INSTANCE = new ConstexprParametersProperty();
+
+  private ConstexprParametersProperty() {
+    super();
+  }
+
+  @Override
+  public String name() {
+    return "constexpr-parameters";
+  }
+}
@@ -0,0 +1,21 @@
+package org.lflang.target.property;
+
+/**
+ * If true, enable link-time optimization (LTO) when compiling the generated program. In the C
+ * target, this also applies to the runtime and to external implementations of reactions that are
+ * added with cmake-include. The default is false.
+ */
+public final class LtoProperty extends BooleanProperty {
+
+  /** Singleton target property instance. */
+  public static final LtoProperty INSTANCE = new LtoProperty();
+
+  private LtoProperty() {
+    super();
+  }
+
+  @Override
+  public String name() {
+    return "lto";
+  }
+}
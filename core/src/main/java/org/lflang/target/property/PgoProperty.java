@@ -0,0 +1,159 @@
+package org.lflang.target.property;
+
+import java.util.Objects;
+import org.lflang.MessageReporter;
+import org.lflang.ast.ASTUtils;
+import org.lflang.lf.Element;
+import org.lflang.lf.KeyValuePair;
+import org.lflang.lf.KeyValuePairs;
+import org.lflang.lf.LfFactory;
+import org.lflang.lf.LfPackage.Literals;
+import org.lflang.target.TargetConfig;
+import org.lflang.target.property.PgoProperty.PgoOptions;
+import org.lflang.target.property.type.BuildTypeType.BuildType;
+import org.lflang.target.property.type.DictionaryType;
+import org.lflang.target.property.type.DictionaryType.DictionaryElement;
+import org.lflang.target.property.type.PrimitiveType;
+import org.lflang.target.property.type.TargetPropertyType;
+import org.lflang.target.property.type.UnionType;
+
+/**
+ * Directive to build the generated program with profile-guided optimization (PGO). This is either
+ * a boolean, true or false, or a dictionary of options. If enabled, the program is first compiled
+ * with instrumentation, then executed once with the given training arguments, and finally
+ * recompiled using the collected profile. To report the effect of the optimization, a build without
+ * instrumentation is executed with the same arguments before and compared to the optimized build.
+ */
+public final class PgoProperty extends TargetProperty<PgoOptions, UnionType> {
+
+  /** Singleton target property instance. */
+  public static final PgoProperty INSTANCE = new PgoProperty();
+
+  private PgoProperty() {
+    super(UnionType.PGO_UNION);
+  }
+
+  @Override
+  public PgoOptions initialValue() {
+    return new PgoOptions(false);
+  }
+
+  @Override
+  public PgoOptions fromAst(Element node, MessageReporter reporter) {
+    var enabled = false;
+    var args = "";
+    if (node.getLiteral() != null) {
+      if (ASTUtils.toBoolean(node)) {
+        enabled = true;
+      }
+    } else if (node.getKeyvalue() != null) {
+      enabled = true;
+      for (KeyValuePair entry : node.getKeyvalue().getPairs()) {
+        PgoOption option = (PgoOption) DictionaryType.PGO_DICT.forName(entry.getName());
+        if (Objects.requireNonNull(option) == PgoOption.ARGS) {
+          args = ASTUtils.elementToSingleString(entry.getValue());
+        }
+      }
+    }
+    return new PgoOptions(enabled, args);
+  }
+
+  @Override
+  protected PgoOptions fromString(String string, MessageReporter reporter) {
+    throw new UnsupportedOperationException("Not supported yet.");
+  }
+
+  @Override
+  public void validate(TargetConfig config, MessageReporter reporter) {
+    if (!config.get(this).enabled()) {
+      return;
+    }
+    var pair = config.lookup(this);
+    if (config.isSet(Ros2Property.INSTANCE) && config.get(Ros2Property.INSTANCE)) {
+      reporter
+          .at(pair, Literals.KEY_VALUE_PAIR__NAME)
+          .warning("Profile-guided optimization is not supported for ROS 2 builds and is ignored.");
+    }
+    var buildType = config.get(BuildTypeProperty.INSTANCE);
+    if (buildType == BuildType.DEBUG || buildType == BuildType.TEST) {
+      reporter
+          .at(pair, Literals.KEY_VALUE_PAIR__NAME)
+          .warning(
+              "Profile-guided optimization has little effect on unoptimized builds. Consider"
+                  + " setting 'build-type: Release'.");
+    }
+  }
+
+  @Override
+  public Element toAstElement(PgoOptions value) {
+    if (!value.enabled()) {
+      return null;
+    } else if (value.equals(new PgoOptions(true))) {
+      // default configuration
+      return ASTUtils.toElement(true);
+    } else {
+      Element e = LfFactory.eINSTANCE.createElement();
+      KeyValuePairs kvp = LfFactory.eINSTANCE.createKeyValuePairs();
+      for (PgoOption opt : PgoOption.values()) {
+        KeyValuePair pair = LfFactory.eINSTANCE.createKeyValuePair();
+        pair.setName(opt.toString());
+        if (opt == PgoOption.ARGS) {
+          if (value.args().isEmpty()) {
+            continue;
+          }
+          pair.setValue(ASTUtils.toElement(value.args()));
+        }
+        kvp.getPairs().add(pair);
+      }
+      e.setKeyvalue(kvp);
+      if (kvp.getPairs().isEmpty()) {
+        return null;
+      }
+      return e;
+    }
+  }
+
+  @Override
+  public String name() {
+    return "pgo";
+  }
+
+  /**
+   * Settings related to profile-guided optimization.
+   *
+   * @param enabled Whether to perform a profile-guided build.
+   * @param args The command line arguments passed to the program during the training run, for
+   *     instance {@code "--timeout 1s --fast"}.
+   */
+  public record PgoOptions(boolean enabled, String args) {
+
+    public PgoOptions(boolean enabled) {
+      this(enabled, "");
+    }
+  }
+
+  /** Profile-guided optimization options. */
+  public enum PgoOption implements DictionaryElement {
+    ARGS("args", PrimitiveType.STRING);
+
+    public final PrimitiveType type;
+
+    private final String description;
+
+    PgoOption(String alias, PrimitiveType type) {
+      this.description = alias;
+      this.type = type;
+    }
+
+    /** Return the description of this dictionary element. */
+    @Override
+    public String toString() {
+      return this.description;
+    }
+
+    /** Return the type associated with this dictionary element. */
+    public TargetPropertyType getType() {
+      return this.type;
+    }
+  }
+}
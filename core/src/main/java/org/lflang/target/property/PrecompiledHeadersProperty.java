@@ -0,0 +1,20 @@
+package org.lflang.target.property;
+
+/**
+ * If true, precompile the runtime headers that are included by every generated source file. The
+ * default is false.
+ */
+public final class PrecompiledHeadersProperty extends BooleanProperty {
+
+  /** Singleton target property instance. */
+  public static final PrecompiledHeadersProperty INSTANCE = new PrecompiledHeadersProperty();
+
+  private PrecompiledHeadersProperty() {
+    super();
+  }
+
+  @Override
+  public String name() {
+    return "precompiled-headers";
+  }
+}
@@ -0,0 +1,51 @@
+package org.lflang.target.property;
+
+import org.lflang.MessageReporter;
+import org.lflang.lf.LfPackage.Literals;
+import org.lflang.target.TargetConfig;
+
+/**
+ * If true, link the generated program against a precompiled runtime library from a user-level cache
+ * that is shared across projects instead of compiling the runtime as part of every project. The
+ * default is false.
+ *
+ * <p>The cache is located in the directory given by the {@code LF_RUNTIME_CACHE} environment
+ * variable, or in {@code lingua-franca} within the user's cache directory otherwise.
+ */
+public final class RuntimeCacheProperty extends BooleanProperty {
+
+  /** Singleton target property instance. */
+  public static final RuntimeCacheProperty INSTANCE = new RuntimeCacheProperty();
+
+  private RuntimeCacheProperty() {
+    super();
+  }
+
+  @Override
+  public String name() {
+    return "runtime-cache";
+  }
+
+  @Override
+  public void validate(TargetConfig config, MessageReporter reporter) {
+    if (!config.get(this)) {
+      return;
+    }
+    var pair = config.lookup(this);
+    if (config.isSet(ExternalRuntimePathProperty.INSTANCE)) {
+      reporter
+          .at(pair, Literals.KEY_VALUE_PAIR__NAME)
+          .warning("The runtime cache is not used if an external runtime path is given.");
+    }
+    if (config.isSet(Ros2Property.INSTANCE) && config.get(Ros2Property.INSTANCE)) {
+      reporter
+          .at(pair, Literals.KEY_VALUE_PAIR__NAME)
+          .warning("The runtime cache is not supported for ROS 2 builds and is ignored.");
+    }
+    if (config.get(PgoProperty.INSTANCE).enabled()) {
+      reporter
+          .at(pair, Literals.KEY_VALUE_PAIR__NAME)
+          .error("The runtime cache cannot be combined with profile-guided optimization.");
+    }
+  }
+}
@@ -0,0 +1,20 @@
+package org.lflang.target.property;
+
+/**
+ * Directive for tuning the generated code for a specific CPU (e.g., 'native' or 'skylake'). The
+ * value is passed to the compiler via '-march'. If not set, the compiler's default is used.
+ */
+public final class TargetCpuProperty extends StringProperty {
+
+  /** Singleton target property instance. */
+  public static final TargetCpuProperty INSTANCE = new TargetCpuProperty();
+
+  private TargetCpuProperty() {
+    super();
+  }
+
+  @Override
+  public String name() {
+    return "target-cpu";
+  }
+}
@@ -0,0 +1,22 @@
+package org.lflang.target.property;
+
+/**
+ * If true, group the generated source files into a small number of larger translation units (unity
+ * or jumbo build). This reduces the time spent on parsing common headers and enables inlining
+ * across reactors. The C target combines all sources into a single translation unit, except for
+ * reactors with preambles or type parameters. The default is false.
+ */
+public final class UnityBuildProperty extends BooleanProperty {
+
+  /** Singleton target property instance. */
+  public static final UnityBuildProperty INSTANCE = new UnityBuildProperty();
+
+  private UnityBuildProperty() {
+    super();
+  }
+
+  @Override
+  public String name() {
+    return "unity-build";
+  }
+}
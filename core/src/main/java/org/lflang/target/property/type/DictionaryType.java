@@ -13,6 +13,7 @@ import org.lflang.target.Target;
 import org.lflang.target.property.ClockSyncOptionsProperty.ClockSyncOption;
 import org.lflang.target.property.CoordinationOptionsProperty.CoordinationOption;
 import org.lflang.target.property.DockerProperty.DockerOption;
+import org.lflang.target.property.PgoProperty.PgoOption;
 import org.lflang.target.property.PlatformProperty.PlatformOption;
 import org.lflang.target.property.TracingProperty.TracingOption;
 
@@ -26,6 +27,7 @@ public enum DictionaryType implements TargetPropertyType {
   DOCKER_DICT(Arrays.asList(DockerOption.values())),
   PLATFORM_DICT(Arrays.asList(PlatformOption.values())),
   COORDINATION_OPTION_DICT(Arrays.asList(CoordinationOption.values())),
+  PGO_DICT(Arrays.asList(PgoOption.values())),
   TRACING_DICT(Arrays.asList(TracingOption.values()));
 
   /** The keys and assignable types that are allowed in this dictionary. */
@@ -44,8 +44,10 @@ import org.lflang.lf.VarRef
  * The assemble method is called once during initialization by the reactor runtime. It is
  * responsible for declaring all triggers, dependencies and effects (antidependencies) of reactions.
  * It is also responsible for creating all connections within the reactor.
+ *
+ * @param deadCode The analysis used for eliding reactions that are never triggered, or null if nothing is elided
  */
-class CppAssembleMethodGenerator(private val reactor: Reactor) {
+class CppAssembleMethodGenerator(private val reactor: Reactor, private val deadCode: CppDeadCodeAnalysis? = null) {
 
     private fun iterateOverAllPortsAndApply(
         varRef: VarRef,
@@ -215,10 +217,11 @@ class CppAssembleMethodGenerator(private val reactor: Reactor) {
      */
     fun generateDefinition() = with(PrependOperator) {
         val indexedConnections = reactor.connections.withIndex()
+        val reactions = reactor.reactions.filterNot { deadCode?.isNeverTriggered(it) == true }
         """
             |${reactor.templateLine}
             |void ${reactor.templateName}::assemble() {
-        ${" |  "..reactor.reactions.joinToString("\n\n") { assembleReaction(it) }}
+        ${" |  "..reactions.joinToString("\n\n") { assembleReaction(it) }}
         ${" |  "..indexedConnections.joinToString("\n", prefix = "// connections\n") { declareConnection(it.value, it.index) }}
             |}
         """.trimMargin()
@@ -0,0 +1,76 @@
+package org.lflang.generator.cpp
+
+import org.lflang.inferredType
+import org.lflang.lf.Initializer
+import org.lflang.lf.Instantiation
+import org.lflang.lf.Literal
+import org.lflang.lf.Parameter
+import org.lflang.lf.ParameterReference
+import org.lflang.lf.Reactor
+import org.lflang.lf.Time
+import org.lflang.reactor
+
+/**
+ * Determines the parameters that have the same statically known value in all instances of a reactor.
+ *
+ * A parameter qualifies if its type is an arithmetic type or a time, and if every instance assigns it a literal, a
+ * time value, or a reference to another qualifying parameter of the container. Instances that do not assign the
+ * parameter contribute its default value. Such parameters can be declared as `static constexpr` in the generated
+ * code, which allows the C++ compiler to fold them into the reaction bodies.
+ *
+ * @param reactors All reactors of the program
+ */
+class CppConstexprParameters(reactors: List<Reactor>) {
+
+    companion object {
+        /** Types that may be used for constexpr parameters (in addition to time) */
+        private val arithmeticTypes = setOf(
+            "bool", "char", "signed char", "unsigned char", "short", "unsigned short", "int", "unsigned", "unsigned int",
+            "long", "unsigned long", "long long", "unsigned long long", "float", "double", "long double",
+            "size_t", "std::size_t", "std::int8_t", "std::uint8_t", "std::int16_t", "std::uint16_t",
+            "std::int32_t", "std::uint32_t", "std::int64_t", "std::uint64_t"
+        )
+    }
+
+    private val instantiations: Map<Reactor, List<Instantiation>> =
+        reactors.flatMap { it.instantiations }.groupBy { it.reactor }
+
+    private val values = mutableMapOf<Parameter, String?>()
+
+    /** Return the C++ expression of the static value of the given parameter, or null if it is not statically known. */
+    fun valueOf(param: Parameter): String? {
+        if (param !in values) {
+            values[param] = computeValue(param)
+        }
+        return values[param]
+    }
+
+    /** Return true if the given parameter is known at compile time. */
+    fun isConstexpr(param: Parameter): Boolean = valueOf(param) != null
+
+    private fun computeValue(param: Parameter): String? {
+        val type = param.inferredType
+        // bank_index is assigned individually for each bank member
+        if (param.name == "bank_index" || !(type.isTime || type.cppType in arithmeticTypes)) {
+            return null
+        }
+        val default = param.init?.let { staticValue(it, param) }
+        val reactor = param.eContainer() as Reactor
+        val instances = instantiations[reactor] ?: listOf()
+        val candidates = if (instances.isEmpty()) listOf(default) else instances.map { inst ->
+            val assignment = inst.parameters.firstOrNull { it.lhs == param }
+            if (assignment == null) default else staticValue(assignment.rhs, param)
+        }
+        return candidates.distinct().singleOrNull()
+    }
+
+    private fun staticValue(init: Initializer, param: Parameter): String? {
+        val expr = init.expr
+        return when {
+            !init.isAssign                  -> null
+            expr is Literal || expr is Time -> CppTypes.getTargetExpr(expr, param.inferredType)
+            expr is ParameterReference      -> valueOf(expr.parameter)
+            else                            -> null
+        }
+    }
+}
@@ -0,0 +1,86 @@
+package org.lflang.generator.cpp
+
+import org.lflang.MessageReporter
+import org.lflang.lf.Input
+import org.lflang.lf.Instantiation
+import org.lflang.lf.Output
+import org.lflang.lf.Port
+import org.lflang.lf.Reaction
+import org.lflang.lf.Reactor
+import org.lflang.lf.VarRef
+import org.lflang.reactor
+
+/**
+ * A whole-program analysis that finds ports that never carry values and reactions that can never be triggered.
+ *
+ * An input is live if, in at least one instance of its reactor, it is connected to an output of another reactor or
+ * to a live input of the container, or if a reaction of the container writes to it. A reaction that is triggered only
+ * by inputs that are not live can never execute. Such reactions are not registered with the runtime. Their bodies are
+ * still generated, so that they are checked by the compiler.
+ *
+ * Outputs that are never connected or read in any instance are only reported, since reaction bodies may still refer
+ * to them.
+ *
+ * @param reactors All reactors of the program
+ */
+class CppDeadCodeAnalysis(private val reactors: List<Reactor>) {
+
+    private val instantiations: Map<Reactor, List<Instantiation>> =
+        reactors.flatMap { it.instantiations }.groupBy { it.reactor }
+
+    private val liveInputs = mutableMapOf<Input, Boolean>()
+
+    private val Instantiation.container get() = eContainer() as Reactor
+
+    private fun VarRef.refersTo(instance: Instantiation, port: Port) = container == instance && variable == port
+
+    /** Return true if the given input may receive values at runtime. */
+    fun isLive(input: Input): Boolean = liveInputs.getOrPut(input) {
+        val instances = instantiations[input.eContainer() as Reactor] ?: listOf()
+        instances.any { inst ->
+            val isConnected = inst.container.connections.any { c ->
+                c.rightPorts.any { it.refersTo(inst, input) } && c.leftPorts.any { left ->
+                    // outputs of contained reactors are considered live
+                    val source = left.variable
+                    left.container != null || source !is Input || isLive(source)
+                }
+            }
+            isConnected || inst.container.reactions.any { r -> r.effects.any { it.refersTo(inst, input) } }
+        }
+    }
+
+    /** Return true if the given output is neither connected nor read in any instance of its reactor. */
+    fun isUnconnected(output: Output): Boolean {
+        val instances = instantiations[output.eContainer() as Reactor] ?: listOf()
+        return instances.none { inst ->
+            inst.container.connections.any { c -> c.leftPorts.any { it.refersTo(inst, output) } } ||
+                    inst.container.reactions.any { r ->
+                        (r.triggers.filterIsInstance<VarRef>() + r.sources).any { it.refersTo(inst, output) }
+                    }
+        }
+    }
+
+    /** Return true if the given reaction is triggered only by inputs that never receive values. */
+    fun isNeverTriggered(reaction: Reaction): Boolean =
+        reaction.triggers.isNotEmpty() && reaction.triggers.all {
+            it is VarRef && it.container == null && (it.variable as? Input)?.let { input -> !isLive(input) } == true
+        }
+
+    /**
+     * Report the number of elided reactions and of unconnected outputs in one summary for the whole program.
+     *
+     * Single diagnostics for each output would be noisy for libraries and for reactors that are reused on purpose.
+     */
+    fun report(messageReporter: MessageReporter) {
+        // reactors that are not instantiated are not part of the program
+        val instantiated = reactors.filter { !it.isMain && it in instantiations }
+        val removed = instantiated.sumOf { r -> r.reactions.count { isNeverTriggered(it) } }
+        val unconnected = instantiated.sumOf { r -> r.outputs.count { isUnconnected(it) } }
+        if (removed > 0 || unconnected > 0) {
+            messageReporter.nowhere().info(
+                "Removed $removed reaction(s) that are never triggered. " +
+                        "$unconnected output(s) are not connected in any instance of their reactor."
+            )
+        }
+    }
+}
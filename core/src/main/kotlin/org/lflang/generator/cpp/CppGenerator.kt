@@ -28,6 +28,7 @@ package org.lflang.generator.cpp
 
 import org.eclipse.emf.ecore.resource.Resource
 import org.lflang.target.Target
+import org.lflang.target.TargetConfig
 import org.lflang.generator.*
 import org.lflang.generator.GeneratorUtils.canGenerate
 import org.lflang.generator.LFGeneratorContext.Mode
@@ -47,10 +48,17 @@ class CppGenerator(
 
     // keep a list of all source files we generate
     val cppSources = mutableListOf<Path>()
+    // sources that must be compiled separately in unity builds (a subset of cppSources)
+    val nonUnitySources = mutableListOf<Path>()
     val codeMaps = mutableMapOf<Path, CodeMap>()
 
     val fileConfig: CppFileConfig = context.fileConfig as CppFileConfig
 
+    /** The parameters that are known at compile time, or null if parameters are not specialized */
+    val constexprParameters: CppConstexprParameters? by lazy {
+        if (targetConfig.get(ConstexprParametersProperty.INSTANCE)) CppConstexprParameters(reactors) else null
+    }
+
     companion object {
         /** Path to the Cpp lib directory (relative to class path)  */
         const val libDir = "/lib/cpp"
@@ -58,6 +66,14 @@ class CppGenerator(
         const val MINIMUM_CMAKE_VERSION = "3.5"
 
         const val CPP_VERSION = "20"
+
+        /** Return the name of the directory that the reactor-cpp sources are placed in (e.g., reactor-cpp-default). */
+        fun reactorCppName(targetConfig: TargetConfig): String =
+            if (targetConfig.isSet(RuntimeVersionProperty.INSTANCE)) {
+                "reactor-cpp-${targetConfig.get(RuntimeVersionProperty.INSTANCE)}"
+            } else {
+                "reactor-cpp-default"
+            }
     }
 
     override fun doGenerate(resource: Resource, context: LFGeneratorContext) {
@@ -101,8 +117,7 @@ class CppGenerator(
         }
     }
 
-    private fun fetchReactorCpp(version: String) {
-        val libPath = fileConfig.srcGenBasePath.resolve("reactor-cpp-$version")
+    private fun fetchReactorCpp(version: String, libPath: Path) {
         // abort if the directory already exists
         if (Files.isDirectory(libPath)) {
             return
@@ -111,8 +126,8 @@ class CppGenerator(
         Files.createDirectories(libPath)
         commandFactory.createCommand(
             "git",
-            listOf("clone", "-n", "https://github.com/lf-lang/reactor-cpp.git", "reactor-cpp-$version"),
-            fileConfig.srcGenBasePath
+            listOf("clone", "-n", "https://github.com/lf-lang/reactor-cpp.git", libPath.fileName.toString()),
+            libPath.parent
         ).run()
         commandFactory.createCommand("git", listOf("checkout", version), libPath).run()
     }
@@ -138,26 +153,36 @@ class CppGenerator(
 
         // copy or download reactor-cpp
         if (!targetConfig.isSet(ExternalRuntimePathProperty.INSTANCE)) {
+            val libName = reactorCppName(targetConfig)
+            val libPath = if (CppRuntimeCache.isEnabled(targetConfig)) {
+                // The runtime is built outside of the project. Remove any runtime that was copied by a previous run
+                // so that it is not included in the cmake project.
+                FileUtil.deleteDirectory(fileConfig.srcGenBasePath.resolve(libName))
+                fileConfig.srcGenBasePath.resolve(CppRuntimeCache.SOURCE_DIR_NAME).resolve(libName)
+            } else {
+                fileConfig.srcGenBasePath.resolve(libName)
+            }
             if (targetConfig.isSet(RuntimeVersionProperty.INSTANCE)) {
-                fetchReactorCpp(targetConfig.get(RuntimeVersionProperty.INSTANCE))
+                fetchReactorCpp(targetConfig.get(RuntimeVersionProperty.INSTANCE), libPath)
             } else {
-                FileUtil.copyFromClassPath(
-                    "$libDir/reactor-cpp",
-                    fileConfig.srcGenBasePath.resolve("reactor-cpp-default"),
-                    true,
-                    true
-                )
+                FileUtil.copyFromClassPath("$libDir/reactor-cpp", libPath, true, true)
             }
         }
 
+        // find reactions that can never be triggered in this program
+        val deadCode = CppDeadCodeAnalysis(reactors)
+        deadCode.report(messageReporter)
+
         // generate header and source files for all reactors
         for (r in reactors) {
-            val generator = CppReactorGenerator(r, fileConfig, messageReporter)
+            val generator = CppReactorGenerator(r, fileConfig, messageReporter, constexprParameters, deadCode)
             val headerFile = fileConfig.getReactorHeaderPath(r)
             val sourceFile = if (r.isGeneric) fileConfig.getReactorHeaderImplPath(r) else fileConfig.getReactorSourcePath(r)
             val reactorCodeMap = CodeMap.fromGeneratedCode(generator.generateSource())
             if (!r.isGeneric)
                 cppSources.add(sourceFile)
+            if (!r.isGeneric && generator.hasPrivatePreamble)
+                nonUnitySources.add(sourceFile)
             codeMaps[srcGenPath.resolve(sourceFile)] = reactorCodeMap
             val headerCodeMap = CodeMap.fromGeneratedCode(generator.generateHeader())
             codeMaps[srcGenPath.resolve(headerFile)] = headerCodeMap
@@ -166,6 +191,12 @@ class CppGenerator(
             FileUtil.writeToFile(reactorCodeMap.generatedCode, srcGenPath.resolve(sourceFile), true)
         }
 
+        // explicitly instantiate the template specializations used by the program in a single source file
+        CppTemplateInstantiationGenerator.generateSource(reactors, fileConfig)?.let {
+            val sourceFile = CppTemplateInstantiationGenerator.sourcePath
+            cppSources.add(sourceFile)
+            FileUtil.writeToFile(it, srcGenPath.resolve(sourceFile), true)
+        }
 
         // generate file level preambles for all resources
         for (r in resources) {
@@ -174,6 +205,8 @@ class CppGenerator(
             val headerFile = fileConfig.getPreambleHeaderPath(r)
             val preambleCodeMap = CodeMap.fromGeneratedCode(generator.generateSource())
             cppSources.add(sourceFile)
+            if (generator.hasPrivatePreamble)
+                nonUnitySources.add(sourceFile)
             codeMaps[srcGenPath.resolve(sourceFile)] = preambleCodeMap
             val headerCodeMap = CodeMap.fromGeneratedCode(generator.generateHeader())
             codeMaps[srcGenPath.resolve(headerFile)] = headerCodeMap
@@ -44,7 +44,7 @@ class CppInstanceGenerator(
                 AttributeUtils.getEnclaveAttribute(this), AttributeSpec.EACH_ATTR
             ) ?: false
 
-        private val Instantiation.reactorType: String
+        val Instantiation.reactorType: String
             get() = if (reactor.isGeneric)
                 """${reactor.name}<${typeArgs.joinToString(", ") { it.toText() }}>"""
             else
@@ -29,8 +29,15 @@ import org.lflang.joinWithLn
 import org.lflang.lf.Parameter
 import org.lflang.lf.Reactor
 
-/** A C++ code generator for reactor parameters */
-class CppParameterGenerator(private val reactor: Reactor) {
+/**
+ * A C++ code generator for reactor parameters
+ *
+ * @param constexprParameters The parameters that are known at compile time, or null if parameters are not specialized
+ */
+class CppParameterGenerator(
+    private val reactor: Reactor,
+    private val constexprParameters: CppConstexprParameters? = null
+) {
 
     companion object {
 
@@ -58,10 +65,15 @@ class CppParameterGenerator(private val reactor: Reactor) {
         }
 
     /** Generate alias declarations for each parameter for use in the inner reactor class.
-     *  This is required to bring parameters into scope.
+     *  This is required to bring parameters into scope. Parameters that are known at compile time are declared as
+     *  constants instead, so that the compiler can fold them into the reaction bodies.
      */
     fun generateInnerAliasDeclarations() =
-        reactor.parameters.joinToString(separator = "") { "const typename Parameters::${it.typeAlias}& ${it.name} = __lf_parameters.${it.name};\n" }
+        reactor.parameters.joinToString(separator = "") {
+            val value = constexprParameters?.valueOf(it)
+            if (value != null) "static constexpr typename Parameters::${it.typeAlias} ${it.name} = $value;\n"
+            else "const typename Parameters::${it.typeAlias}& ${it.name} = __lf_parameters.${it.name};\n"
+        }
 
     /** Generate alias declarations for each parameter for use in the outer reactor class.
      *  This is required for some code bodies (e.g. target code in parameter initializers) to have access to the local parameters.
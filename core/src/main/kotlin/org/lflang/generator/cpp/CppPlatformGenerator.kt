@@ -16,6 +16,7 @@ import java.nio.file.Path
 abstract class CppPlatformGenerator(protected val generator: CppGenerator) {
     protected val codeMaps = generator.codeMaps
     protected val cppSources = generator.cppSources
+    protected val nonUnitySources = generator.nonUnitySources
     protected val messageReporter: MessageReporter = generator.messageReporter
     protected val fileConfig: CppFileConfig = generator.fileConfig
     protected val targetConfig: TargetConfig = generator.targetConfig
@@ -29,12 +30,17 @@ abstract class CppPlatformGenerator(protected val generator: CppGenerator) {
     abstract fun doCompile(context: LFGeneratorContext, onlyGenerateBuildFiles: Boolean = false): Boolean
 
     protected val cmakeArgs: List<String>
+        get() = runtimeCmakeArgs + listOf(
+            "-DLF_SRC_PKG_PATH=${fileConfig.srcPkgPath}",
+        )
+
+    /** The cmake arguments that configure the runtime library. */
+    protected val runtimeCmakeArgs: List<String>
         get() = listOf(
             "-DCMAKE_BUILD_TYPE=${targetConfig.get(BuildTypeProperty.INSTANCE)}",
             "-DREACTOR_CPP_VALIDATE=${if (targetConfig.get(NoRuntimeValidationProperty.INSTANCE)) "OFF" else "ON"}",
             "-DREACTOR_CPP_PRINT_STATISTICS=${if (targetConfig.get(PrintStatisticsProperty.INSTANCE)) "ON" else "OFF"}",
             "-DREACTOR_CPP_TRACE=${if (targetConfig.get(TracingProperty.INSTANCE).isEnabled) "ON" else "OFF"}",
             "-DREACTOR_CPP_LOG_LEVEL=${targetConfig.get(LoggingProperty.INSTANCE).severity}",
-            "-DLF_SRC_PKG_PATH=${fileConfig.srcPkgPath}",
         )
 }
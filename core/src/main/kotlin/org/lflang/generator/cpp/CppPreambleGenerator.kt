@@ -42,6 +42,9 @@ class CppPreambleGenerator(
     /** A list of all preambles defined in the resource (file) */
     private val preambles: EList<Preamble> = resource.model.preambles
 
+    /** True if the resource defines a private file-level preamble. */
+    val hasPrivatePreamble: Boolean get() = preambles.any { it.isPrivate }
+
     fun generateHeader(): String {
         val importedResources = scopeProvider.getImportedResources(resource)
         val includes = importedResources.map { """#include "${fileConfig.getPreambleHeaderPath(it)}"""" }
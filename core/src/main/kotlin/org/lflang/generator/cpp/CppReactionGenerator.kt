@@ -42,10 +42,15 @@ import org.lflang.lf.VarRef
 import org.lflang.priority
 import org.lflang.toText
 
-/** A C++ code generator for reactions and their function bodies */
+/**
+ * A C++ code generator for reactions and their function bodies
+ *
+ * @param deadCode The analysis used for eliding reactions that are never triggered, or null if nothing is elided
+ */
 class CppReactionGenerator(
     private val reactor: Reactor,
-    private val portGenerator: CppPortGenerator
+    private val portGenerator: CppPortGenerator,
+    private val deadCode: CppDeadCodeAnalysis? = null
 ) {
 
     private val reactionsWithDeadlines = reactor.reactions.filter { it.deadline != null }
@@ -243,9 +248,10 @@ class CppReactionGenerator(
             generateViewConstructorInitializers(it)
         }
 
-    /** Get all reaction declarations. */
+    /** Get all reaction declarations. Reactions that are never triggered are omitted. */
     fun generateDeclarations() =
-        reactor.reactions.joinToString(separator = "\n", prefix = "// reactions\n", postfix = "\n") { generateDeclaration(it) }
+        reactor.reactions.filterNot { deadCode?.isNeverTriggered(it) == true }
+            .joinToString(separator = "\n", prefix = "// reactions\n", postfix = "\n") { generateDeclaration(it) }
 
     /** Get all declarations of reaction bodies. */
     fun generateBodyDeclarations() =
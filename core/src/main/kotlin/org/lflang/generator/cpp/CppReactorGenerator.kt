@@ -33,7 +33,13 @@ import org.lflang.toUnixString
 /**
  * A C++ code generator that produces a C++ class representing a single reactor
  */
-class CppReactorGenerator(private val reactor: Reactor, fileConfig: CppFileConfig, messageReporter: MessageReporter) {
+class CppReactorGenerator(
+    private val reactor: Reactor,
+    fileConfig: CppFileConfig,
+    messageReporter: MessageReporter,
+    constexprParameters: CppConstexprParameters? = null,
+    deadCode: CppDeadCodeAnalysis? = null
+) {
 
     /** Comment to be inserted at the top of generated files */
     private val fileComment = fileComment(reactor.eResource())
@@ -47,15 +53,22 @@ class CppReactorGenerator(private val reactor: Reactor, fileConfig: CppFileConfi
     /** The header file that contains the public file-level preamble of the file containing `reactor` */
     private val preambleHeaderFile = fileConfig.getPreambleHeaderPath(reactor.eResource()).toUnixString()
 
-    private val parameters = CppParameterGenerator(reactor)
+    private val parameters = CppParameterGenerator(reactor, constexprParameters)
     private val state = CppStateGenerator(reactor)
     private val methods = CppMethodGenerator(reactor)
     private val instances = CppInstanceGenerator(reactor, fileConfig, messageReporter)
     private val timers = CppTimerGenerator(reactor)
     private val actions = CppActionGenerator(reactor, messageReporter)
     private val ports = CppPortGenerator(reactor)
-    private val reactions = CppReactionGenerator(reactor, ports)
-    private val assemble = CppAssembleMethodGenerator(reactor)
+    private val reactions = CppReactionGenerator(reactor, ports, deadCode)
+    private val assemble = CppAssembleMethodGenerator(reactor, deadCode)
+    private val templateInstantiations = CppTemplateInstantiationGenerator(reactor)
+
+    /**
+     * True if the reactor defines a private preamble. Private preambles may introduce names with internal linkage
+     * that clash with other generated sources, so such sources are excluded from unity builds.
+     */
+    val hasPrivatePreamble: Boolean get() = reactor.preambles.any { it.isPrivate }
 
     private fun publicPreamble() =
         reactor.preambles.filter { it.isPublic }
@@ -83,6 +96,8 @@ class CppReactorGenerator(private val reactor: Reactor, fileConfig: CppFileConfi
             |
         ${" |"..publicPreamble()}
             |
+        ${" |"..templateInstantiations.generateExternDeclarations()}
+            |
             |${reactor.templateLine}
             |class ${reactor.name}: public reactor::Reactor {
             |public:
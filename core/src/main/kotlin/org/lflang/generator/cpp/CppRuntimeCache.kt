@@ -0,0 +1,107 @@
+package org.lflang.generator.cpp
+
+import org.lflang.target.TargetConfig
+import org.lflang.target.property.CompilerProperty
+import org.lflang.target.property.ExternalRuntimePathProperty
+import org.lflang.target.property.Ros2Property
+import org.lflang.target.property.RuntimeCacheProperty
+import org.lflang.toUnixString
+import java.nio.channels.FileChannel
+import java.nio.file.Files
+import java.nio.file.Path
+import java.nio.file.Paths
+import java.nio.file.StandardOpenOption
+import java.security.MessageDigest
+
+/**
+ * A user-level cache of compiled reactor-cpp builds that is shared across projects.
+ *
+ * Each cache entry contains a build directory and an installation of reactor-cpp. Entries are keyed by a hash over
+ * the runtime sources, the compiler, the host platform and all cmake arguments used for building the runtime.
+ *
+ * @param sourcePath Path to the reactor-cpp sources
+ * @param cmakeArgs The cmake arguments used for configuring the runtime build
+ * @param compiler The C++ compiler used for building the runtime (empty if the default compiler is used)
+ */
+class CppRuntimeCache(val sourcePath: Path, val cmakeArgs: List<String>, private val compiler: String) {
+
+    companion object {
+        /** Name of the directory within src-gen that holds the runtime sources if the cache is used. */
+        const val SOURCE_DIR_NAME = "runtime-sources"
+
+        /** Name of the file that marks a complete cache entry. */
+        private const val COMPLETE_MARKER = ".lf-complete"
+
+        /** Return true if the given configuration requests using the runtime cache. */
+        fun isEnabled(targetConfig: TargetConfig) =
+            targetConfig.get(RuntimeCacheProperty.INSTANCE) &&
+                    !targetConfig.isSet(ExternalRuntimePathProperty.INSTANCE) &&
+                    !targetConfig.get(Ros2Property.INSTANCE)
+
+        /** Return the compiler used for building the runtime with the given configuration. */
+        fun compiler(targetConfig: TargetConfig): String =
+            if (targetConfig.isSet(CompilerProperty.INSTANCE)) targetConfig.get(CompilerProperty.INSTANCE)
+            else System.getenv("CXX") ?: ""
+
+        /** The root directory of the cache. */
+        val rootPath: Path
+            get() {
+                System.getenv("LF_RUNTIME_CACHE")?.let { return Paths.get(it) }
+                val cacheHome = System.getenv("XDG_CACHE_HOME")?.let { Paths.get(it) }
+                    ?: Paths.get(System.getProperty("user.home"), ".cache")
+                return cacheHome.resolve("lingua-franca")
+            }
+    }
+
+    /** The directory of the cache entry matching the current sources and configuration. */
+    val entryPath: Path by lazy { rootPath.resolve("reactor-cpp").resolve(computeKey()) }
+
+    /** The directory that reactor-cpp is built in. */
+    val buildPath: Path get() = entryPath.resolve("build")
+
+    /** The directory that reactor-cpp is installed to. */
+    val installPath: Path get() = entryPath.resolve("install")
+
+    /** Return true if the cache entry was built and installed completely. */
+    fun isComplete(): Boolean = Files.exists(entryPath.resolve(COMPLETE_MARKER))
+
+    /**
+     * Populate the cache entry using the given build function while holding an exclusive lock on the entry.
+     *
+     * The build function is not called if the entry is complete already, which might be the case if another process
+     * built the runtime while we waited for the lock.
+     * @return True if the entry is complete
+     */
+    fun populate(build: () -> Boolean): Boolean {
+        Files.createDirectories(entryPath)
+        FileChannel.open(
+            entryPath.resolve(".lock"),
+            StandardOpenOption.CREATE,
+            StandardOpenOption.WRITE
+        ).use { channel ->
+            channel.lock().use {
+                if (!isComplete() && build()) {
+                    Files.createFile(entryPath.resolve(COMPLETE_MARKER))
+                }
+            }
+        }
+        return isComplete()
+    }
+
+    private fun computeKey(): String {
+        val digest = MessageDigest.getInstance("SHA-256")
+        for (value in cmakeArgs + listOf(compiler, System.getProperty("os.name"), System.getProperty("os.arch"))) {
+            digest.update(value.toByteArray())
+            digest.update(0)
+        }
+        val sources = Files.walk(sourcePath).use { paths ->
+            paths.filter { Files.isRegularFile(it) && !sourcePath.relativize(it).startsWith(".git") }.sorted().toList()
+        }
+        for (file in sources) {
+            digest.update(sourcePath.relativize(file).toUnixString().toByteArray())
+            digest.update(Files.readAllBytes(file))
+        }
+        // a shortened hash is sufficient to distinguish entries and keeps the paths readable
+        return digest.digest().take(16).joinToString("") { "%02x".format(it) }
+    }
+}
@@ -31,12 +31,25 @@ import org.lflang.joinWithLn
 import org.lflang.target.property.BuildTypeProperty
 import org.lflang.target.property.CmakeIncludeProperty
 import org.lflang.target.property.ExternalRuntimePathProperty
+import org.lflang.target.property.LtoProperty
+import org.lflang.target.property.PgoProperty
+import org.lflang.target.property.PrecompiledHeadersProperty
 import org.lflang.target.property.RuntimeVersionProperty
+import org.lflang.target.property.TargetCpuProperty
+import org.lflang.target.property.UnityBuildProperty
 import org.lflang.toUnixString
 import java.nio.file.Path
 
-/** Code generator for producing a cmake script for compiling all generated C++ sources */
-class CppStandaloneCmakeGenerator(private val targetConfig: TargetConfig, private val fileConfig: FileConfig) {
+/**
+ * Code generator for producing a cmake script for compiling all generated C++ sources
+ *
+ * @param runtimeCache The runtime cache to link against, or null if reactor-cpp is built as part of the project
+ */
+class CppStandaloneCmakeGenerator(
+    private val targetConfig: TargetConfig,
+    private val fileConfig: FileConfig,
+    private val runtimeCache: CppRuntimeCache? = null
+) {
 
     companion object {
         /** Return the name of the variable that gives the includes of the given target. */
@@ -90,7 +103,7 @@ class CppStandaloneCmakeGenerator(private val targetConfig: TargetConfig, privat
             |if(NOT CMAKE_BUILD_TYPE AND NOT CMAKE_CONFIGURATION_TYPES)
             |set    (CMAKE_BUILD_TYPE "$S{DEFAULT_BUILD_TYPE}" CACHE STRING "Choose the type of build." FORCE)
             |endif()
-            |
+            |${generateOptimizationOptions()}
             |if (APPLE)
             |   file(RELATIVE_PATH REL_LIB_PATH 
             |        "$S{CMAKE_INSTALL_PREFIX}/$S{CMAKE_INSTALL_BINDIR}"
@@ -125,6 +138,81 @@ class CppStandaloneCmakeGenerator(private val targetConfig: TargetConfig, privat
         }
     }
 
+    /**
+     * Generate cmake code for the optional optimizations (LTO, target CPU tuning and PGO).
+     *
+     * The flags are set globally in the root project, so that they apply to the runtime library as well as to the
+     * generated program. Returns an empty string if no optimization is configured.
+     */
+    private fun generateOptimizationOptions(): String {
+        val targetCpu = targetConfig.get(TargetCpuProperty.INSTANCE)
+        val lto = if (!targetConfig.get(LtoProperty.INSTANCE)) "" else """
+            |# Enable link-time optimization
+            |if(POLICY CMP0069)
+            |  cmake_policy(SET CMP0069 NEW)
+            |  set(CMAKE_POLICY_DEFAULT_CMP0069 NEW)
+            |  include(CheckIPOSupported)
+            |  check_ipo_supported(RESULT LF_IPO_SUPPORTED OUTPUT LF_IPO_ERROR LANGUAGES CXX)
+            |  if(LF_IPO_SUPPORTED)
+            |    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON)
+            |  else()
+            |    message(WARNING "Link-time optimization is not supported: $S{LF_IPO_ERROR}")
+            |  endif()
+            |else()
+            |  message(WARNING "Link-time optimization requires CMake 3.9 or newer")
+            |endif()
+        """.trimMargin()
+        val cpu = if (targetCpu.isNullOrEmpty()) "" else """
+            |# Tune the generated code for a specific CPU
+            |if(CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+            |  set(CMAKE_CXX_FLAGS "$S{CMAKE_CXX_FLAGS} -march=$targetCpu")
+            |else()
+            |  message(WARNING "Ignoring target-cpu since it is not supported by the selected compiler")
+            |endif()
+        """.trimMargin()
+        val pgo = if (!targetConfig.get(PgoProperty.INSTANCE).enabled) "" else """
+            |# Profile-guided optimization. The phase is selected by lfc when invoking cmake.
+            |set(LF_PGO_MODE "" CACHE STRING "The profile-guided optimization phase (GENERATE or USE).")
+            |set(LF_PGO_PROFILE_DIR "$S{CMAKE_BINARY_DIR}/pgo-profiles" CACHE PATH "Directory for storing profiles.")
+            |if(LF_PGO_MODE STREQUAL "GENERATE")
+            |  if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+            |    set(LF_PGO_FLAGS "-fprofile-generate=$S{LF_PGO_PROFILE_DIR} -fprofile-update=atomic")
+            |  elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+            |    set(LF_PGO_FLAGS "-fprofile-generate=$S{LF_PGO_PROFILE_DIR}")
+            |  else()
+            |    message(FATAL_ERROR "Profile-guided optimization is not supported by the selected compiler")
+            |  endif()
+            |elseif(LF_PGO_MODE STREQUAL "USE")
+            |  if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+            |    set(LF_PGO_FLAGS "-fprofile-use=$S{LF_PGO_PROFILE_DIR} -fprofile-correction -Wno-missing-profile")
+            |  elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+            |    find_program(LLVM_PROFDATA_BIN NAMES llvm-profdata)
+            |    if(NOT LLVM_PROFDATA_BIN)
+            |      message(FATAL_ERROR "llvm-profdata is required for profile-guided optimization with clang")
+            |    endif()
+            |    file(GLOB LF_PGO_RAW_PROFILES "$S{LF_PGO_PROFILE_DIR}/*.profraw")
+            |    execute_process(
+            |      COMMAND $S{LLVM_PROFDATA_BIN} merge -output=$S{LF_PGO_PROFILE_DIR}/merged.profdata $S{LF_PGO_RAW_PROFILES}
+            |      RESULT_VARIABLE LF_PGO_MERGE_RESULT
+            |    )
+            |    if(NOT LF_PGO_MERGE_RESULT EQUAL 0)
+            |      message(FATAL_ERROR "Failed to merge the collected profiles")
+            |    endif()
+            |    set(LF_PGO_FLAGS "-fprofile-use=$S{LF_PGO_PROFILE_DIR}/merged.profdata -Wno-profile-instr-unprofiled")
+            |  else()
+            |    message(FATAL_ERROR "Profile-guided optimization is not supported by the selected compiler")
+            |  endif()
+            |endif()
+            |if(LF_PGO_FLAGS)
+            |  set(CMAKE_CXX_FLAGS "$S{CMAKE_CXX_FLAGS} $S{LF_PGO_FLAGS}")
+            |  set(CMAKE_EXE_LINKER_FLAGS "$S{CMAKE_EXE_LINKER_FLAGS} $S{LF_PGO_FLAGS}")
+            |  set(CMAKE_SHARED_LINKER_FLAGS "$S{CMAKE_SHARED_LINKER_FLAGS} $S{LF_PGO_FLAGS}")
+            |endif()
+        """.trimMargin()
+        val options = listOf(lto, cpu, pgo).filter { it.isNotEmpty() }
+        return if (options.isEmpty()) "" else options.joinToString("\n\n", prefix = "\n", postfix = "\n")
+    }
+
     fun generateSubdirCmake(): String {
         return """
             |file(GLOB subdirs RELATIVE "$S{CMAKE_CURRENT_SOURCE_DIR}" "$S{CMAKE_CURRENT_SOURCE_DIR}/*")
@@ -138,14 +226,62 @@ class CppStandaloneCmakeGenerator(private val targetConfig: TargetConfig, privat
         """.trimMargin()
     }
 
-    fun generateCmake(sources: List<Path>): String {
+    /**
+     * Generate cmake code for compiling the main target as a unity build and with precompiled runtime headers.
+     *
+     * Both features require CMake 3.16. Older versions fall back to a regular build. Returns an empty string if
+     * neither feature is enabled.
+     *
+     * @param nonUnitySources Sources that must not be merged with other sources in a unity build
+     */
+    private fun generateBuildAcceleration(nonUnitySources: List<Path>): String {
+        val skipUnity = if (nonUnitySources.isEmpty()) "" else with(PrependOperator) {
+            """
+                |  set_source_files_properties(
+            ${" |    "..nonUnitySources.joinWithLn { it.toUnixString() }}
+                |    PROPERTIES SKIP_UNITY_BUILD_INCLUSION ON
+                |  )
+            """.trimMargin()
+        }
+        val unity = if (!targetConfig.get(UnityBuildProperty.INSTANCE)) "" else """
+            |# Compile the generated sources in batches (unity build)
+            |if(NOT CMAKE_VERSION VERSION_LESS 3.16)
+            |  set_target_properties($S{LF_MAIN_TARGET} PROPERTIES UNITY_BUILD ON UNITY_BUILD_BATCH_SIZE 16)
+            |${skipUnity}
+            |else()
+            |  message(WARNING "Unity builds require CMake 3.16 or newer")
+            |endif()
+        """.trimMargin().replace("\n\n", "\n")
+        val pch = if (!targetConfig.get(PrecompiledHeadersProperty.INSTANCE)) "" else """
+            |# Precompile the runtime headers that are included by all generated sources
+            |if(NOT CMAKE_VERSION VERSION_LESS 3.16)
+            |  target_precompile_headers($S{LF_MAIN_TARGET} PRIVATE
+            |    <reactor-cpp/reactor-cpp.hh>
+            |    "$S{PROJECT_SOURCE_DIR}/__include__/lfutil.hh"
+            |  )
+            |else()
+            |  message(WARNING "Precompiled headers require CMake 3.16 or newer")
+            |endif()
+        """.trimMargin()
+        val options = listOf(unity, pch).filter { it.isNotEmpty() }
+        return if (options.isEmpty()) "" else options.joinToString("\n\n", prefix = "\n", postfix = "\n")
+    }
+
+    fun generateCmake(sources: List<Path>, nonUnitySources: List<Path> = listOf()): String {
         // Resolve path to the cmake include files if any was provided
         val includeFiles = targetConfig.get(CmakeIncludeProperty.INSTANCE)?.map { fileConfig.srcPath.resolve(it).toUnixString() }
 
+        // Path to an installation of reactor-cpp, if the runtime is not built as part of the project
+        val runtimePath = when {
+            targetConfig.isSet(ExternalRuntimePathProperty.INSTANCE) -> targetConfig.get(ExternalRuntimePathProperty.INSTANCE)
+            runtimeCache != null                                     -> runtimeCache.installPath.toUnixString()
+            else                                                     -> null
+        }
+
         val reactorCppTarget = when {
-            targetConfig.isSet(ExternalRuntimePathProperty.INSTANCE) -> "reactor-cpp"
-            targetConfig.isSet(RuntimeVersionProperty.INSTANCE)      -> "reactor-cpp-${targetConfig.get(RuntimeVersionProperty.INSTANCE)}"
-            else                                   -> "reactor-cpp-default"
+            runtimePath != null                                 -> "reactor-cpp"
+            targetConfig.isSet(RuntimeVersionProperty.INSTANCE) -> "reactor-cpp-${targetConfig.get(RuntimeVersionProperty.INSTANCE)}"
+            else                                                -> "reactor-cpp-default"
         }
 
         return with(PrependOperator) {
@@ -153,7 +289,7 @@ class CppStandaloneCmakeGenerator(private val targetConfig: TargetConfig, privat
                 |cmake_minimum_required(VERSION 3.5)
                 |project(${fileConfig.name} VERSION 0.0.0 LANGUAGES CXX)
                 |
-                |${if (targetConfig.get(ExternalRuntimePathProperty.INSTANCE) != null) "find_package(reactor-cpp PATHS ${targetConfig.get(ExternalRuntimePathProperty.INSTANCE)})" else ""}
+                |${if (runtimePath != null) "find_package(reactor-cpp PATHS $runtimePath)" else ""}
                 |
                 |set(LF_MAIN_TARGET ${fileConfig.name})
                 |
@@ -167,6 +303,9 @@ class CppStandaloneCmakeGenerator(private val targetConfig: TargetConfig, privat
                 |)
                 |target_link_libraries($S{LF_MAIN_TARGET} $reactorCppTarget)
                 |
+                |# Make sure that a runtime library installed outside of the project is found by the installed binary
+                |set_target_properties($S{LF_MAIN_TARGET} PROPERTIES INSTALL_RPATH_USE_LINK_PATH ON)
+                |${generateBuildAcceleration(nonUnitySources)}
                 |if(MSVC)
                 |  target_compile_options($S{LF_MAIN_TARGET} PRIVATE /W4)
                 |else()
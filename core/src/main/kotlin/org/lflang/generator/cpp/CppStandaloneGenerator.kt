@@ -3,7 +3,11 @@ package org.lflang.generator.cpp
 import org.lflang.generator.CodeMap
 import org.lflang.generator.LFGeneratorContext
 import org.lflang.target.property.BuildTypeProperty
+import org.lflang.target.property.CmakeIncludeProperty
 import org.lflang.target.property.CompilerProperty
+import org.lflang.target.property.LtoProperty
+import org.lflang.target.property.PgoProperty
+import org.lflang.target.property.TargetCpuProperty
 import org.lflang.target.property.type.BuildTypeType.BuildType
 import org.lflang.toUnixString
 import org.lflang.util.FileUtil
@@ -11,11 +15,39 @@ import org.lflang.util.LFCommand
 import java.nio.file.Files
 import java.nio.file.Path
 import java.nio.file.Paths
+import java.security.MessageDigest
 
 /** C++ platform generator for the default native platform  without additional dependencies.*/
 class CppStandaloneGenerator(generator: CppGenerator) :
     CppPlatformGenerator(generator) {
 
+    companion object {
+        /** Name of the file in the build directory that stores the hash of the inputs of the last cmake run. */
+        const val CMAKE_INPUTS_HASH_FILE = "lf-cmake-inputs.sha256"
+    }
+
+    /** The shared runtime cache if it is enabled, or null if reactor-cpp is built as part of the project. */
+    private val runtimeCache: CppRuntimeCache? by lazy {
+        if (CppRuntimeCache.isEnabled(targetConfig)) {
+            val buildType = buildTypeToCmakeConfig(targetConfig.get(BuildTypeProperty.INSTANCE))
+            val args = runtimeCmakeArgs.filterNot { it.startsWith("-DCMAKE_BUILD_TYPE=") }.toMutableList()
+            args.add("-DCMAKE_BUILD_TYPE=$buildType")
+            if (targetConfig.get(LtoProperty.INSTANCE)) {
+                args.add("-DCMAKE_POLICY_DEFAULT_CMP0069=NEW")
+                args.add("-DCMAKE_INTERPROCEDURAL_OPTIMIZATION=ON")
+            }
+            if (targetConfig.get(TargetCpuProperty.INSTANCE).isNotEmpty()) {
+                args.add("-DCMAKE_CXX_FLAGS=-march=${targetConfig.get(TargetCpuProperty.INSTANCE)}")
+            }
+            CppRuntimeCache(
+                fileConfig.srcGenBasePath.resolve(CppRuntimeCache.SOURCE_DIR_NAME)
+                    .resolve(CppGenerator.reactorCppName(targetConfig)),
+                args,
+                CppRuntimeCache.compiler(targetConfig)
+            )
+        } else null
+    }
+
     override fun generatePlatformFiles() {
 
         // generate the main source file (containing main())
@@ -25,7 +57,8 @@ class CppStandaloneGenerator(generator: CppGenerator) :
                 CppStandaloneMainGenerator(
                     mainReactor,
                     generator.targetConfig,
-                    generator.fileConfig
+                    generator.fileConfig,
+                    generator.constexprParameters
                 ).generateCode()
             )
         cppSources.add(mainFile)
@@ -35,11 +68,11 @@ class CppStandaloneGenerator(generator: CppGenerator) :
         FileUtil.writeToFile(mainCodeMap.generatedCode, srcGenPath.resolve(mainFile), true)
 
         // generate the cmake scripts
-        val cmakeGenerator = CppStandaloneCmakeGenerator(targetConfig, generator.fileConfig)
+        val cmakeGenerator = CppStandaloneCmakeGenerator(targetConfig, generator.fileConfig, runtimeCache)
         val srcGenRoot = fileConfig.srcGenBasePath
         val pkgName = fileConfig.srcGenPkgPath.fileName.toString()
         FileUtil.writeToFile(cmakeGenerator.generateRootCmake(pkgName), srcGenRoot.resolve("CMakeLists.txt"), true)
-        FileUtil.writeToFile(cmakeGenerator.generateCmake(cppSources), srcGenPath.resolve("CMakeLists.txt"), true)
+        FileUtil.writeToFile(cmakeGenerator.generateCmake(cppSources, nonUnitySources), srcGenPath.resolve("CMakeLists.txt"), true)
         FileUtil.writeToFile("", srcGenPath.resolve(".lf-cpp-marker"), true)
         var subdir = srcGenPath.parent
         while (subdir != srcGenRoot) {
@@ -62,35 +95,151 @@ class CppStandaloneGenerator(generator: CppGenerator) :
         Files.createDirectories(fileConfig.buildPath)
 
         val version = checkCmakeVersion()
-        if (version != null) {
-            val cmakeReturnCode = runCmake(context)
-
-            if (cmakeReturnCode == 0 && runMake) {
-                // If cmake succeeded, run make
-                val makeCommand = createMakeCommand(fileConfig.buildPath, version, fileConfig.name)
-                val makeReturnCode = CppValidator(fileConfig, messageReporter, codeMaps).run(makeCommand, context.cancelIndicator)
-                var installReturnCode = 0
-                if (makeReturnCode == 0) {
-                    val installCommand = createMakeCommand(fileConfig.buildPath, version, "install")
-                    installReturnCode = installCommand.run(context.cancelIndicator)
-                    if (installReturnCode == 0) {
-                        println("SUCCESS (compiling generated C++ code)")
-                        println("Generated source code is in ${fileConfig.srcGenPath}")
-                        println("Compiled binary is in ${fileConfig.binPath}")
-                    }
-                }
-                if ((makeReturnCode != 0 || installReturnCode != 0) && !messageReporter.errorsOccurred) {
-                    // If errors occurred but none were reported, then the following message is the best we can do.
-                    messageReporter.nowhere().error("make failed with error code $makeReturnCode")
-                }
+        val cache = runtimeCache
+        if (version != null && (cache == null || buildRuntimeCache(context, version, cache))) {
+            val pgo = targetConfig.get(PgoProperty.INSTANCE)
+            val success = if (pgo.enabled && runMake) {
+                compileWithPgo(context, version, pgo.args)
+            } else {
+                compile(context, version, runMake)
             }
-            if (cmakeReturnCode != 0) {
-                messageReporter.nowhere().error("cmake failed with error code $cmakeReturnCode")
+            if (success && runMake) {
+                println("SUCCESS (compiling generated C++ code)")
+                println("Generated source code is in ${fileConfig.srcGenPath}")
+                println("Compiled binary is in ${fileConfig.binPath}")
             }
         }
         return !messageReporter.errorsOccurred
     }
 
+    /**
+     * Run cmake and, if [runMake] is true, build and install the program.
+     * @param extraCmakeArgs Additional arguments passed to cmake when generating the build files
+     * @return True, if all steps completed successfully
+     */
+    private fun compile(
+        context: LFGeneratorContext,
+        version: String,
+        runMake: Boolean,
+        extraCmakeArgs: List<String> = listOf()
+    ): Boolean {
+        val cmakeReturnCode = runCmake(context, extraCmakeArgs)
+        if (cmakeReturnCode != 0) {
+            messageReporter.nowhere().error("cmake failed with error code $cmakeReturnCode")
+            return false
+        }
+        if (!runMake) {
+            return true
+        }
+
+        // If cmake succeeded, run make
+        val makeCommand = createMakeCommand(fileConfig.buildPath, version, fileConfig.name)
+        val makeReturnCode = CppValidator(fileConfig, messageReporter, codeMaps).run(makeCommand, context.cancelIndicator)
+        var installReturnCode = 0
+        if (makeReturnCode == 0) {
+            val installCommand = createMakeCommand(fileConfig.buildPath, version, "install")
+            installReturnCode = installCommand.run(context.cancelIndicator)
+        }
+        if ((makeReturnCode != 0 || installReturnCode != 0) && !messageReporter.errorsOccurred) {
+            // If errors occurred but none were reported, then the following message is the best we can do.
+            messageReporter.nowhere().error("make failed with error code $makeReturnCode")
+        }
+        return makeReturnCode == 0 && installReturnCode == 0
+    }
+
+    /**
+     * Build and install reactor-cpp into the given cache entry, unless the entry is complete already.
+     * @return True, if the runtime is available in the cache
+     */
+    private fun buildRuntimeCache(context: LFGeneratorContext, version: String, cache: CppRuntimeCache): Boolean {
+        if (cache.isComplete()) {
+            println("Using reactor-cpp from the runtime cache at ${cache.entryPath}")
+            return true
+        }
+        val success = cache.populate {
+            println("--- Building reactor-cpp in the runtime cache at ${cache.entryPath}")
+            Files.createDirectories(cache.buildPath)
+            val cmakeCommand = commandFactory.createCommand(
+                "cmake",
+                cache.cmakeArgs + listOf(
+                    "-DCMAKE_INSTALL_PREFIX=${cache.installPath.toUnixString()}",
+                    cache.sourcePath.toUnixString()
+                ),
+                cache.buildPath
+            )
+            if (targetConfig.isSet(CompilerProperty.INSTANCE)) {
+                cmakeCommand.setEnvironmentVariable("CXX", targetConfig.get(CompilerProperty.INSTANCE))
+            }
+            cmakeCommand.run(context.cancelIndicator) == 0 &&
+                    createMakeCommand(cache.buildPath, version, "install").run(context.cancelIndicator) == 0
+        }
+        if (!success) {
+            messageReporter.nowhere().error("Failed to build reactor-cpp in the runtime cache at ${cache.entryPath}")
+        }
+        return success
+    }
+
+    /**
+     * Build the program with profile-guided optimization.
+     *
+     * This first builds the program without instrumentation and executes it with the given training arguments to
+     * obtain a baseline. It then builds an instrumented binary, executes it with the same arguments to collect a
+     * profile, and rebuilds the program using the profile. Finally, the optimized binary is executed once more, so
+     * that its execution time can be compared to the baseline. The execution time of the instrumented binary is not
+     * comparable, since it is dominated by the instrumentation overhead.
+     */
+    private fun compileWithPgo(context: LFGeneratorContext, version: String, trainingArgs: String): Boolean {
+        val profileDir = fileConfig.buildPath.resolve("pgo-profiles")
+        // discard any profiles that were collected for a previous version of the program
+        FileUtil.deleteDirectory(profileDir)
+        Files.createDirectories(profileDir)
+        val profileDirArg = "-DLF_PGO_PROFILE_DIR=${profileDir.toUnixString()}"
+
+        println("--- PGO: building baseline binary")
+        // LF_PGO_MODE is cached by cmake, so it needs to be reset explicitly
+        if (!compile(context, version, true, listOf("-DLF_PGO_MODE=", profileDirArg))) return false
+        val baselineTime = runTrainingWorkload(context, trainingArgs) ?: return false
+
+        println("--- PGO: building instrumented binary")
+        if (!compile(context, version, true, listOf("-DLF_PGO_MODE=GENERATE", profileDirArg))) return false
+
+        println("--- PGO: collecting profile (${fileConfig.name} $trainingArgs)")
+        runTrainingWorkload(context, trainingArgs) ?: return false
+
+        println("--- PGO: building optimized binary")
+        if (!compile(context, version, true, listOf("-DLF_PGO_MODE=USE", profileDirArg))) return false
+
+        val optimizedTime = runTrainingWorkload(context, trainingArgs) ?: return false
+        println(
+            "--- PGO: training run took $baselineTime ms without PGO and $optimizedTime ms with the optimized binary"
+        )
+        return true
+    }
+
+    /**
+     * Execute the compiled program with the given arguments.
+     * @return The execution time in milliseconds or null if the program could not be executed successfully
+     */
+    private fun runTrainingWorkload(context: LFGeneratorContext, args: String): Long? {
+        val cmd = commandFactory.createCommand(
+            fileConfig.executable.toString(),
+            splitArguments(args),
+            fileConfig.binPath
+        )
+        if (cmd == null) {
+            messageReporter.nowhere().error("Could not execute ${fileConfig.executable} for profile-guided optimization")
+            return null
+        }
+        val start = System.nanoTime()
+        val returnCode = cmd.run(context.cancelIndicator)
+        val elapsed = (System.nanoTime() - start) / 1_000_000
+        if (returnCode != 0) {
+            messageReporter.nowhere().error("PGO training run failed with error code $returnCode")
+            return null
+        }
+        return elapsed
+    }
+
     private fun checkCmakeVersion(): String? {
         // get the installed cmake version and make sure it is at least 3.5
         val cmd = commandFactory.createCommand("cmake", listOf("--version"), fileConfig.buildPath)
@@ -114,11 +263,68 @@ class CppStandaloneGenerator(generator: CppGenerator) :
 
     /**
      * Run CMake to generate build files.
-     * @return True, if cmake run successfully
+     *
+     * CMake is not invoked if the build directory was already configured with the same arguments and the same
+     * cmake scripts. Changes to the content of existing cmake scripts would be detected by the build tool anyway, but
+     * new subdirectories and changed arguments are only picked up when running cmake explicitly.
+     * @return The cmake return code (0 if cmake was skipped)
+     */
+    private fun runCmake(context: LFGeneratorContext, extraArgs: List<String>): Int {
+        val cmakeCommand = createCmakeCommand(fileConfig.buildPath, fileConfig.outPath, extraArgs)
+        val hashFile = fileConfig.buildPath.resolve(CMAKE_INPUTS_HASH_FILE)
+        val hash = hashCmakeInputs(cmakeCommand)
+        if (Files.isRegularFile(fileConfig.buildPath.resolve("CMakeCache.txt")) && FileUtil.isSame(hash, hashFile)) {
+            println("Build files are up to date. Skipping cmake.")
+            return 0
+        }
+        Files.deleteIfExists(hashFile)
+        val returnCode = cmakeCommand.run(context.cancelIndicator)
+        if (returnCode == 0) {
+            FileUtil.writeToFile(hash, hashFile)
+        }
+        return returnCode
+    }
+
+    /**
+     * Compute a hash over all inputs of the cmake configure step.
+     *
+     * This includes the cmake arguments, the selected compiler, and all cmake scripts in the src-gen directory as well
+     * as any files included via the cmake-include target property.
+     */
+    private fun hashCmakeInputs(cmakeCommand: LFCommand): String {
+        val digest = MessageDigest.getInstance("SHA-256")
+        for (arg in cmakeCommand.command()) {
+            digest.update(arg.toByteArray())
+            digest.update(0)
+        }
+        if (targetConfig.isSet(CompilerProperty.INSTANCE)) {
+            digest.update(targetConfig.get(CompilerProperty.INSTANCE).toByteArray())
+        }
+
+        val srcGenRoot = fileConfig.srcGenBasePath
+        val scripts = Files.walk(srcGenRoot).use { paths ->
+            paths.filter {
+                val name = it.fileName.toString()
+                Files.isRegularFile(it) && (name == "CMakeLists.txt" || name == ".lf-cpp-marker" || name.endsWith(".cmake"))
+            }.sorted().toList()
+        }
+        val includes = targetConfig.get(CmakeIncludeProperty.INSTANCE)?.map { fileConfig.srcPath.resolve(it) } ?: listOf()
+        for (script in scripts + includes.filter { Files.isRegularFile(it) }) {
+            digest.update(script.toUnixString().toByteArray())
+            digest.update(Files.readAllBytes(script))
+        }
+        return digest.digest().joinToString("") { "%02x".format(it) }
+    }
+
+    /**
+     * Split a command line string into separate arguments.
+     *
+     * Arguments are separated by whitespace, unless the whitespace is enclosed in single or double quotes
+     * (e.g., `--timeout '1 s'`).
      */
-    private fun runCmake(context: LFGeneratorContext): Int {
-        val cmakeCommand = createCmakeCommand(fileConfig.buildPath, fileConfig.outPath)
-        return cmakeCommand.run(context.cancelIndicator)
+    private fun splitArguments(args: String): List<String> {
+        val regex = """"([^"]*)"|'([^']*)'|(\S+)""".toRegex()
+        return regex.findAll(args).map { match -> match.groupValues.drop(1).firstOrNull { it.isNotEmpty() } ?: "" }.toList()
     }
 
     private fun String.compareVersion(other: String): Int {
@@ -160,10 +366,10 @@ class CppStandaloneGenerator(generator: CppGenerator) :
         return commandFactory.createCommand("cmake", makeArgs, buildPath)
     }
 
-    private fun createCmakeCommand(buildPath: Path, outPath: Path): LFCommand {
+    private fun createCmakeCommand(buildPath: Path, outPath: Path, extraArgs: List<String>): LFCommand {
         val cmd = commandFactory.createCommand(
             "cmake",
-            cmakeArgs + listOf(
+            cmakeArgs + extraArgs + listOf(
                 "-DCMAKE_INSTALL_PREFIX=${outPath.toUnixString()}",
                 "-DCMAKE_INSTALL_BINDIR=${outPath.relativize(fileConfig.binPath).toUnixString()}",
                 fileConfig.srcGenBasePath.toUnixString()
@@ -17,12 +17,16 @@ class CppStandaloneMainGenerator(
     private val main: Reactor,
     private val targetConfig: TargetConfig,
     private val fileConfig: CppFileConfig,
+    private val constexprParameters: CppConstexprParameters? = null,
 ) {
     // Cxxopts generation
     private fun generateParameterParser(param: Parameter): String {
         with(CppParameterGenerator) {
             with(param) {
-                return if(inferredType.isTime) {
+                return if (constexprParameters?.isConstexpr(param) == true) {
+                    // parameters that are known at compile time cannot be overridden
+                    "$targetType $name${CppTypes.getCppInitializer(init, inferredType)};"
+                } else if(inferredType.isTime) {
                     """
                         $targetType $name${CppTypes.getCppInitializer(init, inferredType)};
                         options
@@ -0,0 +1,85 @@
+package org.lflang.generator.cpp
+
+import org.lflang.toText
+import org.lflang.generator.cpp.CppActionGenerator.Companion.cppType
+import org.lflang.generator.cpp.CppInstanceGenerator.Companion.reactorType
+import org.lflang.inferredType
+import org.lflang.isGeneric
+import org.lflang.joinWithLn
+import org.lflang.lf.Reactor
+import org.lflang.reactor
+import org.lflang.toUnixString
+import java.nio.file.Path
+import java.nio.file.Paths
+
+/**
+ * A code generator for explicit template instantiations.
+ *
+ * Each non-generic reactor declares the concrete template specializations that it uses as `extern template` in its
+ * header. A single source file for the whole program then provides the explicit instantiation definitions. This way,
+ * generic reactors and the port and action templates of the runtime are compiled once, instead of in every
+ * translation unit that uses them.
+ *
+ * Only specializations whose template arguments are spelled as built-in types are considered. Different spellings of
+ * the same type (e.g. an alias) would otherwise lead to duplicate explicit instantiations. All other specializations
+ * are still instantiated implicitly.
+ */
+class CppTemplateInstantiationGenerator(private val reactor: Reactor) {
+
+    companion object {
+        /** Path of the source file containing all explicit instantiation definitions */
+        val sourcePath: Path = Paths.get("__lf_template_instantiations.cc")
+
+        /** Built-in types in their canonical spelling */
+        private val builtinTypes = setOf(
+            "bool", "char", "signed char", "unsigned char", "short", "unsigned short", "int", "unsigned int", "long",
+            "unsigned long", "long long", "unsigned long long", "float", "double", "long double", "std::string"
+        )
+
+        /**
+         * Generate the source file that explicitly instantiates all specializations declared by the given reactors.
+         *
+         * Returns null if there is nothing to instantiate.
+         */
+        fun generateSource(reactors: List<Reactor>, fileConfig: CppFileConfig): String? {
+            val generators = reactors.map { CppTemplateInstantiationGenerator(it) }.filter { it.specializations.isNotEmpty() }
+            if (generators.isEmpty()) {
+                return null
+            }
+            val specializations = generators.flatMap { it.specializations }.distinct()
+            val includes = generators.map { fileConfig.getReactorHeaderPath(it.reactor).toUnixString() }.distinct()
+            return """
+                |// explicit template instantiations for the whole program
+                |
+                |${includes.joinWithLn { """#include "$it"""" }}
+                |
+                |${specializations.joinWithLn { "template class $it;" }}
+            """.trimMargin()
+        }
+    }
+
+    /** All template specializations used by the reactor that are instantiated explicitly. */
+    val specializations: List<String> by lazy {
+        if (reactor.isGeneric) {
+            // the template arguments used within a generic reactor are not known
+            return@lazy listOf()
+        }
+        val reactors = reactor.instantiations.filter { inst ->
+            inst.reactor.isGeneric && inst.typeArgs.all { it.toText() in builtinTypes }
+        }.map { it.reactorType }
+        val ports = (reactor.inputs.map { "reactor::Input" to it.inferredType.cppType } +
+                reactor.outputs.map { "reactor::Output" to it.inferredType.cppType })
+            .filter { (_, dataType) -> dataType in builtinTypes }
+            .map { (portType, dataType) -> "$portType<$dataType>" }
+        val actions = reactor.actions.filter { it.inferredType.cppType in builtinTypes }.map { it.cppType }
+        (reactors + ports + actions).distinct()
+    }
+
+    /** Generate extern template declarations for all explicitly instantiated specializations used by the reactor. */
+    fun generateExternDeclarations(): String =
+        if (specializations.isEmpty()) ""
+        else specializations.joinToString(
+            separator = "\n",
+            prefix = "// explicitly instantiated in ${sourcePath.toUnixString()}\n"
+        ) { "extern template class $it;" }
+}
@@ -0,0 +1,95 @@
+package org.lflang.tests.compiler;
+
+import com.google.inject.Inject;
+import org.eclipse.emf.ecore.util.EcoreUtil;
+import org.eclipse.xtext.testing.InjectWith;
+import org.eclipse.xtext.testing.extensions.InjectionExtension;
+import org.eclipse.xtext.testing.util.ParseHelper;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.extension.ExtendWith;
+import org.lflang.generator.cpp.CppAssembleMethodGenerator;
+import org.lflang.generator.cpp.CppDeadCodeAnalysis;
+import org.lflang.lf.Input;
+import org.lflang.lf.Model;
+import org.lflang.lf.Reactor;
+import org.lflang.tests.LFInjectorProvider;
+
+/** Tests for the analysis that elides reactions of C++ programs that can never be triggered. */
+@ExtendWith(InjectionExtension.class)
+@InjectWith(LFInjectorProvider.class)
+class CppDeadCodeAnalysisTest {
+  @Inject ParseHelper<Model> parser;
+
+  private static final String PROGRAM =
+      """
+      target Cpp
+      reactor Gain {
+        input in: int
+        output out: int
+        reaction(in) -> out {= out.set(*in.get() * 2); =}
+      }
+      reactor Wrapper {
+        input in: int
+        output out: int
+        gain = new Gain()
+        in -> gain.in
+        gain.out -> out
+      }
+      reactor Sink {
+        input in: int
+        reaction(in) {= =}
+      }
+      main reactor {
+        wrapper = new Wrapper()
+        sink = new Sink()
+        wrapper.out -> sink.in
+      }
+      """;
+
+  private Model parse() throws Exception {
+    var model = parser.parse(PROGRAM);
+    Assertions.assertNotNull(model);
+    EcoreUtil.resolveAll(model);
+    Assertions.assertTrue(
+        model.eResource().getErrors().isEmpty(), "Parsing failed: " + model.eResource().getErrors());
+    return model;
+  }
+
+  private static Reactor reactor(Model model, String name) {
+    return model.getReactors().stream()
+        .filter(it -> name.equals(it.getName()))
+        .findFirst()
+        .orElseThrow();
+  }
+
+  private static Input input(Reactor reactor) {
+    return reactor.getInputs().get(0);
+  }
+
+  /** Inputs that are only forwarded from an unconnected input of the container are not live. */
+  @Test
+  public void forwardedUnconnectedInputIsNotLive() throws Exception {
+    var model = parse();
+    var analysis = new CppDeadCodeAnalysis(model.getReactors());
+    Assertions.assertFalse(analysis.isLive(input(reactor(model, "Wrapper"))));
+    Assertions.assertFalse(analysis.isLive(input(reactor(model, "Gain"))));
+    Assertions.assertTrue(analysis.isLive(input(reactor(model, "Sink"))));
+  }
+
+  /** Reactions that are never triggered are not declared to the runtime. */
+  @Test
+  public void neverTriggeredReactionIsElided() throws Exception {
+    var model = parse();
+    var analysis = new CppDeadCodeAnalysis(model.getReactors());
+    var gain = reactor(model, "Gain");
+    var sink = reactor(model, "Sink");
+    Assertions.assertTrue(analysis.isNeverTriggered(gain.getReactions().get(0)));
+    Assertions.assertFalse(analysis.isNeverTriggered(sink.getReactions().get(0)));
+
+    var gainAssembly = new CppAssembleMethodGenerator(gain, analysis).generateDefinition();
+    Assertions.assertFalse(gainAssembly.contains("declare_trigger"), gainAssembly);
+    var sinkAssembly = new CppAssembleMethodGenerator(sink, analysis).generateDefinition();
+    Assertions.assertTrue(sinkAssembly.contains("declare_trigger(&in)"), sinkAssembly);
+  }
+}